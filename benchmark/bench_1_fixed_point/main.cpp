@@ -0,0 +1,99 @@
+/*
+compares the fixed-point scalars with float (time per operation and max error against double)
+pio run -e bench_fixed_point -t exec
+*/
+
+#include <linearAlgebra.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+
+// runs f until at least 50ms elapsed, returns the mean time of one run in ns
+template <typename F>
+double timeIt(F f)
+{
+    size_t runs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    do
+    {
+        f();
+        runs++;
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 5e7);
+    return elapsed / runs;
+}
+
+// keeps the results of the timed dot products alive
+volatile double sink = 0;
+
+// deterministic values in [-scale, scale]
+double value(const size_t i, const size_t j, const double scale)
+{
+    return scale * (((i * 7919 + j * 104729) % 2001) / 1000.0 - 1.0);
+}
+
+template <typename T>
+struct Bench
+{
+    size_t n;
+    Vector<T> x, y, z;
+    rowMajorMatrix<T> a, b, c;
+    ldl_matrix<T> p;
+
+    Bench(const size_t n) : n(n), x(n), y(n), z(n), a(n, n), b(n, n), c(n, n), p(n)
+    {
+        // scaled so that every result fits in [-1, 1)
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = value(i, 1, 0.9);
+            y[i] = value(i, 2, 0.9);
+            for (size_t j = 0; j < n; j++)
+            {
+                a(i, j) = value(i, j, 0.9 / n);
+                b(i, j) = value(j, i, 0.9);
+            }
+            for (size_t j = 0; j <= i; j++)
+                p(i, j) = i == j ? 0.5 : value(i, j, 0.2 / n);
+        }
+    }
+};
+
+template <typename T>
+double get(const T &v) { return (double)v; }
+
+template <typename T>
+void run(const char *name, const size_t n, Bench<double> &ref)
+{
+    Bench<T> bench(n);
+    const double tDot = timeIt([&]() { sink = get(bench.x.dot(bench.y)); });
+    const double tMatVec = timeIt([&]() { bench.z.holdMul(bench.a, bench.x); });
+    const double tMatMul = n <= 64 ? timeIt([&]() { bench.c.holdMul(bench.a, bench.b); }) : NAN;
+    Bench<T> ldl(n);
+    const double tLdl = timeIt([&]() { ldl.p.hold(bench.p); ldl.p.decompose(); });
+
+    double errDot = std::fabs(get(bench.x.dot(bench.y)) - ref.x.dot(ref.y));
+    double errMatVec = 0, errLdl = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        errMatVec = std::fmax(errMatVec, std::fabs(get(bench.z[i]) - ref.z[i]));
+        errLdl = std::fmax(errLdl, std::fabs(get(ldl.p.D(i, i)) - ref.p.D(i, i)));
+    }
+    printf("%-6s %5zu %12.1f %12.1f %12.1f %12.1f   %9.2e %9.2e %9.2e\n", name, n, tDot, tMatVec, tMatMul, tLdl, errDot, errMatVec, errLdl);
+}
+
+int main()
+{
+    printf("%-6s %5s %12s %12s %12s %12s   %9s %9s %9s\n", "type", "n", "dot ns", "matvec ns", "matmul ns", "ldl ns", "err dot", "err mv", "err ldl");
+    const size_t sizes[] = {8, 32, 128};
+    for (const size_t n : sizes)
+    {
+        Bench<double> ref(n);
+        ref.z.holdMul(ref.a, ref.x);
+        ref.p.decompose();
+        run<float>("float", n, ref);
+        run<q15>("q15", n, ref);
+        run<q31>("q31", n, ref);
+    }
+    return 0;
+}
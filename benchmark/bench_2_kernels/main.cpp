@@ -0,0 +1,237 @@
+/*
+times the kernels of every matrix type for float and double, from order 3 to 512, and writes the results to a JSON file to diff between releases
+pio run -e bench_kernels -t exec
+or, once built: .pio/build/bench_kernels/program [output.json] [max order]
+*/
+
+#include <linearAlgebra.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// runs f by batches of doubling size until at least 20ms elapsed, returns the mean time of one run in ns
+template <typename F>
+double timeIt(F f)
+{
+    size_t runs = 0, batch = 1;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    do
+    {
+        for (size_t i = 0; i < batch; i++)
+            f();
+        runs += batch;
+        batch *= 2;
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 2e7);
+    return elapsed / runs;
+}
+
+struct Result
+{
+    std::string kernel, operands, type;
+    size_t n;
+    double ns, flops, bytes;
+};
+
+std::vector<Result> results;
+
+// flops and bytes are the analytic counts of one call : the useful operations (a multiply-add counts 2) and the compulsory traffic (every operand read once, every result written once)
+template <typename F>
+void record(const char *kernel, const char *operands, const char *type, const size_t n, const double flops, const double bytes, F f)
+{
+    Result r = {kernel, operands, type, n, timeIt(f), flops, bytes};
+    printf("%-34s %-34s %-6s %4zu %14.1f %8.3f %12.0f\n", kernel, operands, type, n, r.ns, flops / r.ns, bytes);
+    results.push_back(r);
+}
+
+// deterministic values in [-1, 1]
+double value(const size_t i, const size_t j)
+{
+    return ((i * 7919 + j * 104729) % 2001) / 1000.0 - 1.0;
+}
+
+template <typename M>
+void fillMatrix(M &m)
+{
+    for (size_t i = 0; i < m.rows(); i++)
+        for (size_t j = 0; j < m.cols(); j++)
+            m(i, j) = value(i, j);
+}
+
+// symmetric positive definite, diagonally dominant, with band values below the diagonal
+template <typename M>
+void fillSpd(M &m, const size_t band = (size_t)-1)
+{
+    for (size_t i = 0; i < m.rows(); i++)
+        for (size_t j = i > band ? i - band : 0; j <= i; j++)
+            m(i, j) = i == j ? m.rows() : value(i, j) / 2;
+}
+
+template <typename T>
+void benchOrder(const char *type, const size_t n)
+{
+    const double s = sizeof(T), idx = sizeof(size_t), nn = (double)n * n, tri = n * (n + 1) / 2.0;
+
+    // Vector
+    Vector<T> x(n), y(n), z(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        x[i] = value(i, 1);
+        y[i] = value(i, 2);
+    }
+    record("Vector::hold", "Vector", type, n, 0, 2 * n * s, [&]() { z.hold(x); });
+    record("Vector::holdAdd", "Vector,Vector", type, n, n, 3 * n * s, [&]() { z.holdAdd(x, y); });
+    record("Vector::holdMul", "Vector,Vector", type, n, n, 3 * n * s, [&]() { z.holdMul(x, y); });
+    record("Vector::holdMul", "Vector,scalar", type, n, n, 2 * n * s, [&]() { z.holdMul(x, (T)0.5); });
+    volatile T sink;
+    record("Vector::dot", "Vector,Vector", type, n, 2 * n, 2 * n * s, [&]() { sink = x.dot(y); });
+
+    // dense
+    rowMajorMatrix<T> ar(n, n), br(n, n), cr(n, n);
+    colMajorMatrix<T> ac(n, n), bc(n, n);
+    fillMatrix(ar);
+    fillMatrix(br);
+    fillMatrix(ac);
+    fillMatrix(bc);
+    record("Vector::holdMul", "rowMajorMatrix,Vector", type, n, 2 * nn, (nn + 2 * n) * s, [&]() { z.holdMul(ar, x); });
+    record("Vector::addMul", "rowMajorMatrix,Vector", type, n, 2 * nn + n, (nn + 3 * n) * s, [&]() { z.addMul(ar, x); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,rowMajorMatrix", type, n, 2 * nn * n, 3 * nn * s, [&]() { cr.holdMul(ar, br); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,colMajorMatrix", type, n, 2 * nn * n, 3 * nn * s, [&]() { cr.holdMul(ar, bc); });
+    record("rowMajorMatrix::holdMul", "colMajorMatrix,rowMajorMatrix", type, n, 2 * nn * n, 3 * nn * s, [&]() { cr.holdMul(ac, br); });
+    record("rowMajorMatrix::holdMul", "colMajorMatrix,colMajorMatrix", type, n, 2 * nn * n, 3 * nn * s, [&]() { cr.holdMul(ac, bc); });
+    record("rowMajorMatrix::holdAdd", "rowMajorMatrix,rowMajorMatrix", type, n, nn, 3 * nn * s, [&]() { cr.holdAdd(ar, br); });
+    record("rowMajorMatrix::holdSub", "rowMajorMatrix,colMajorMatrix", type, n, nn, 3 * nn * s, [&]() { cr.holdSub(ar, bc); });
+
+    // packed
+    symMatrix<T> p(n), q(n);
+    fillSpd(p);
+    record("symMatrix::holdMul", "rowMajorMatrix,colMajorMatrix", type, n, 2 * tri * n, (2 * nn + tri) * s, [&]() { q.holdMul(ar, bc); });
+    record("symMatrix::holdMul", "rowMajorMatrix,rowMajorMatrix", type, n, 2 * tri * n, (2 * nn + tri) * s, [&]() { q.holdMul(ar, br); });
+    record("symMatrix::holdMul", "rowMajorMatrix,symMatrix", type, n, 2 * tri * n, (nn + 2 * tri) * s, [&]() { q.holdMul(ar, p); });
+    record("symMatrix::holdMul", "symMatrix,rowMajorMatrix", type, n, 2 * tri * n, (nn + 2 * tri) * s, [&]() { q.holdMul(p, ar); });
+    record("symMatrix::holdMul", "symMatrix,symMatrix", type, n, tri, 3 * tri * s, [&]() { q.holdMul(p, p); });
+    record("symMatrix::holdAdd", "symMatrix,symMatrix", type, n, tri, 3 * tri * s, [&]() { q.holdAdd(p, p); });
+    record("symMatrix::addMul", "rowMajorMatrix,rowMajorMatrix", type, n, 2 * tri * n, (2 * nn + 2 * tri) * s, [&]() { q.addMul(ar, br); });
+    record("symMatrix::addMul", "rowMajorMatrix,colMajorMatrix", type, n, 2 * tri * n, (2 * nn + 2 * tri) * s, [&]() { q.addMul(ar, bc); });
+    record("symMatrix::subMul", "rowMajorMatrix,rowMajorMatrix", type, n, 2 * tri * n, (2 * nn + 2 * tri) * s, [&]() { q.subMul(ar, br); });
+    record("symMatrix::holdAddOuter", "symMatrix,Vector", type, n, 4 * tri, (2 * tri + n) * s, [&]() { q.holdAddOuter((T)0.5, p, (T)0.25, x); });
+    record("Vector::holdMul", "symMatrix,Vector", type, n, 2 * nn, (tri + 2 * n) * s, [&]() { z.holdMul(p, x); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,symMatrix", type, n, 2 * nn * n, (2 * nn + tri) * s, [&]() { cr.holdMul(ar, p); });
+    record("rowMajorMatrix::holdMul", "colMajorMatrix,symMatrix", type, n, 2 * nn * n, (2 * nn + tri) * s, [&]() { cr.holdMul(ac, p); });
+    triangMatrix<T> ta(n), tb(n), tc(n);
+    fillSpd(ta);
+    fillSpd(tb);
+    record("triangMatrix::holdMul", "triangMatrix,triangMatrix", type, n, nn * n / 3, 3 * tri * s, [&]() { tc.holdMul(ta, tb); });
+    ul_triangMatrix<T> la(n), lb(n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < i; j++)
+            la(i, j) = value(i, j) / n;
+    record("ul_triangMatrix::holdInv", "ul_triangMatrix", type, n, nn * n / 3, (nn - n) * s, [&]() { lb.holdInv(la); });
+    ul_triangMatrix<T> lc(n);
+    record("ul_triangMatrix::holdMul", "ul_triangMatrix,ul_triangMatrix", type, n, nn * n / 3, 3 * (tri - n) * s, [&]() { lc.holdMul(la, lb); });
+    diagMatrix<T> da(n), db(n);
+    for (size_t i = 0; i < n; i++)
+        da(i, i) = 1 + i;
+    record("diagMatrix::holdInv", "diagMatrix", type, n, n, 2 * n * s, [&]() { db.holdInv(da); });
+    record("triangMatrix::holdMul", "ul_triangMatrix,diagMatrix", type, n, tri - n, (2 * tri) * s, [&]() { tc.holdMul(la, da); });
+    record("rowMajorMatrix::holdMul", "diagMatrix,rowMajorMatrix", type, n, nn, (2 * nn + n) * s, [&]() { cr.holdMul(da, ar); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,diagMatrix", type, n, nn, (2 * nn + n) * s, [&]() { cr.holdMul(ar, da); });
+    // decompose() reads the packed values and writes L and D, so the copy is made once outside of the timed calls
+    ldl_matrix<T> ldl(n);
+    ldl.hold(p);
+    record("ldl_matrix::decompose", "ldl_matrix", type, n, nn * n / 3, 3 * tri * s, [&]() { ldl.decompose(); });
+    record("symMatrix::holdInv", "ldl_matrix", type, n, nn * n, 4 * tri * s, [&]() { q.holdInv(ldl); });
+    record("Vector::holdSolveLDL", "ldl_matrix,Vector", type, n, 2 * nn, (tri + 2 * n) * s, [&]() { z.holdSolveLDL(ldl, x); });
+    record("rowMajorMatrix::holdSolveLDL", "ldl_matrix,rowMajorMatrix", type, n, 2 * nn * n, (tri + 2 * nn) * s, [&]() { cr.holdSolveLDL(ldl, ar); });
+    uu_triangMatrix<T> ua(n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = i + 1; j < n; j++)
+            ua(i, j) = value(i, j) / n;
+    record("symMatrix::holdMul", "triangMatrix,uu_triangMatrix", type, n, nn * n / 3, (3 * tri - n) * s, [&]() { q.holdMul(ta, ua); });
+
+    // sparse and structured, 5 stored values per row
+    csrMatrix<T> csr;
+    csr.resize(n, n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = i < 2 ? 0 : i - 2; j <= i + 2 && j < n; j++)
+            csr.push_back(i, j, value(i, j));
+    const double nnz = csr.nonZeros();
+    const double sparseBytes = nnz * (s + idx) + (n + 1) * idx;
+    record("Vector::holdMul", "csrMatrix,Vector", type, n, 2 * nnz, sparseBytes + 2 * n * s, [&]() { z.holdMul(csr, x); });
+    record("Vector::addMul", "csrMatrix,Vector", type, n, 2 * nnz, sparseBytes + 3 * n * s, [&]() { z.addMul(csr, x); });
+    record("rowMajorMatrix::holdMul", "csrMatrix,rowMajorMatrix", type, n, 2 * nnz * n, sparseBytes + 2 * nn * s, [&]() { cr.holdMul(csr, ar); });
+    // a * p * a^T, the lower part only
+    double sandwich = 0, lower = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const double rowNnz = csr.rowEnd(i) - csr.rowBegin(i);
+        lower += 2 * rowNnz + 2;
+        sandwich += rowNnz * lower;
+    }
+    record("symMatrix::holdSandwich", "csrMatrix,symMatrix", type, n, sandwich, sparseBytes + 2 * tri * s, [&]() { q.holdSandwich(csr, p); });
+    record("symMatrix::addSandwich", "csrMatrix,symMatrix", type, n, sandwich + tri, sparseBytes + 3 * tri * s, [&]() { q.addSandwich(csr, p); });
+    cscMatrix<T> csc;
+    csc.resize(n, n);
+    for (size_t j = 0; j < n; j++)
+        for (size_t i = j < 2 ? 0 : j - 2; i <= j + 2 && i < n; i++)
+            csc.push_back(i, j, value(i, j));
+    record("Vector::holdMul", "cscMatrix,Vector", type, n, 2 * nnz, sparseBytes + 2 * n * s, [&]() { z.holdMul(csc, x); });
+    record("Vector::addMul", "cscMatrix,Vector", type, n, 2 * nnz, sparseBytes + 3 * n * s, [&]() { z.addMul(csc, x); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,cscMatrix", type, n, 2 * nnz * n, sparseBytes + 2 * nn * s, [&]() { cr.holdMul(ar, csc); });
+    bandMatrix<T> band(n, 2), factor;
+    fillSpd(band, 2);
+    record("Vector::holdMul", "bandMatrix,Vector", type, n, 2 * nnz, (5 * n + 2 * n) * s, [&]() { z.holdMul(band, x); });
+    record("Vector::addMul", "bandMatrix,Vector", type, n, 2 * nnz, (5 * n + 3 * n) * s, [&]() { z.addMul(band, x); });
+    record("rowMajorMatrix::holdMul", "bandMatrix,rowMajorMatrix", type, n, 2 * 5.0 * n * n, (5 * n + 2 * nn) * s, [&]() { cr.holdMul(band, ar); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,bandMatrix", type, n, 2 * 5.0 * n * n, (5 * n + 2 * nn) * s, [&]() { cr.holdMul(ar, band); });
+    record("bandMatrix::holdLDL", "bandMatrix", type, n, 2 * n * 2.0 * 3, 2 * 5 * n * s, [&]() { factor.holdLDL(band); });
+    record("Vector::holdSolveLDL", "bandMatrix,Vector", type, n, 2 * 2 * 2.0 * n + n, (3 * n + 2 * n) * s, [&]() { z.holdSolveLDL(factor, x); });
+    blockDiagMatrix<T> blocks, blockFactor;
+    for (size_t i = 0; i < n; i += 3)
+        blocks.addBlock(n - i < 3 ? n - i : 3, true);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 3 * (i / 3); j <= i; j++)
+            blocks(i, j) = blocks(j, i) = i == j ? 3 : value(i, j) / 2;
+    record("Vector::holdMul", "blockDiagMatrix,Vector", type, n, 6.0 * n, (2 * n + 2 * n) * s, [&]() { z.holdMul(blocks, x); });
+    record("Vector::addMul", "blockDiagMatrix,Vector", type, n, 6.0 * n, (2 * n + 3 * n) * s, [&]() { z.addMul(blocks, x); });
+    record("rowMajorMatrix::holdMul", "blockDiagMatrix,rowMajorMatrix", type, n, 6.0 * nn, (2 * n + 2 * nn) * s, [&]() { cr.holdMul(blocks, ar); });
+    record("rowMajorMatrix::holdMul", "rowMajorMatrix,blockDiagMatrix", type, n, 6.0 * nn, (2 * n + 2 * nn) * s, [&]() { cr.holdMul(ar, blocks); });
+    record("blockDiagMatrix::holdLDL", "blockDiagMatrix", type, n, 3.0 * n, 4 * n * s, [&]() { blockFactor.holdLDL(blocks); });
+    record("Vector::holdSolveLDL", "blockDiagMatrix,Vector", type, n, 5.0 * n, (2 * n + 2 * n) * s, [&]() { z.holdSolveLDL(blockFactor, x); });
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "bench_kernels.json";
+    const size_t maxOrder = argc > 2 ? strtoul(argv[2], nullptr, 10) : 512;
+    printf("%-34s %-34s %-6s %4s %14s %8s %12s\n", "kernel", "operands", "type", "n", "ns/op", "GFLOP/s", "bytes/op");
+    const size_t orders[] = {3, 4, 6, 8, 12, 16, 32, 64, 128, 256, 512};
+    for (const size_t n : orders)
+    {
+        if (n > maxOrder)
+            break;
+        benchOrder<float>("float", n);
+        benchOrder<double>("double", n);
+    }
+
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        printf("cannot write %s\n", path);
+        return 1;
+    }
+    fprintf(file, "{\n  \"benchmark\": \"kernels\",\n  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result &r = results[i];
+        fprintf(file, "    {\"kernel\": \"%s\", \"operands\": \"%s\", \"type\": \"%s\", \"n\": %zu, \"ns_per_op\": %.1f, \"gflops\": %.4f, \"flops_per_op\": %.0f, \"bytes_per_op\": %.0f}%s\n",
+                r.kernel.c_str(), r.operands.c_str(), r.type.c_str(), r.n, r.ns, r.flops / r.ns, r.flops, r.bytes, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    printf("results written to %s\n", path);
+    return 0;
+}
@@ -0,0 +1,261 @@
+/*
+latency distribution of full filter steps (predict + update), warm-up (first iterations, internal::tmp pool growth) against steady state
+pio run -e bench_latency -t exec
+or, once built: .pio/build/bench_latency/program [iterations]
+*/
+
+#include <linearAlgebra.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace operators;
+
+// number of first iterations reported as warm-up
+const size_t warmUp = 100;
+
+double value(const size_t i, const size_t j)
+{
+    return ((i * 7919 + j * 104729) % 2001) / 1000.0 - 1.0;
+}
+
+// Kalman filter of n states and m measurements written with the hold* kernels on packed covariances (no temporary)
+template <typename T>
+struct PackedFilter
+{
+    const size_t n, m;
+    rowMajorMatrix<T> F, H, FP, HP, K;
+    colMajorMatrix<T> Ft, Ht, PHt;
+    symMatrix<T> P, Q, R, S, Sinv;
+    ldl_matrix<T> ldl;
+    Vector<T> x, fx, z, hx, y;
+
+    PackedFilter(const size_t n, const size_t m) : n(n), m(m), F(n, n), H(m, n), FP(n, n), HP(m, n), K(n, m), P(n), Q(n), R(m), S(m), Sinv(m), ldl(m), x(n), fx(n), z(m), hx(m), y(m)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = 0;
+            for (size_t j = 0; j < n; j++)
+                F(i, j) = (i == j) + 0.01 * value(i, j);
+            for (size_t j = 0; j <= i; j++)
+            {
+                P(i, j) = i == j ? 1 : 0;
+                Q(i, j) = i == j ? 1e-3 : 0;
+            }
+        }
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < n; j++)
+                H(i, j) = value(i + 7, j);
+            for (size_t j = 0; j <= i; j++)
+                R(i, j) = i == j ? 0.1 : 0;
+        }
+        // transposed views
+        Ft = colMajorMatrix<T>(F.begin(), n, n);
+        Ht = colMajorMatrix<T>(H.begin(), n, m);
+    }
+
+    void step(const size_t k)
+    {
+        // predict (holdMul must not write its own operand)
+        fx.holdMul(F, x);
+        x.hold(fx, false);
+        FP.holdMul(F, P);
+        P.holdMul(FP, Ft);
+        P.holdAdd(P, Q);
+        // update
+        for (size_t i = 0; i < m; i++)
+            z[i] = 0.1 * value(k % 1000, i);
+        hx.holdMul(H, x);
+        y.holdSub(z, hx);
+        HP.holdMul(H, P);
+        S.holdMul(HP, Ht);
+        S.holdAdd(S, R);
+        ldl.hold(S);
+        Sinv.holdInv(ldl);
+        PHt = colMajorMatrix<T>(HP.begin(), n, m);
+        K.holdMul(PHt, Sinv);
+        x.addMul(K, y);
+        P.subMul(K, HP);
+    }
+};
+
+// the same filter written with the operators on dense matrices, whose intermediate results come from the internal::tmp pool
+template <typename T>
+struct OperatorFilter
+{
+    const size_t n, m;
+    rowMajorMatrix<T> F, Ft, H, Ht, P, Q, R, S, K;
+    Vector<T> x, z, y;
+    ldl_matrix<T> ldl;
+    symMatrix<T> Sinv;
+
+    OperatorFilter(const size_t n, const size_t m) : n(n), m(m), F(n, n), Ft(n, n), H(m, n), Ht(n, m), P(n, n), Q(n, n), R(m, m), S(m, m), K(n, m), x(n), z(m), y(m), ldl(m), Sinv(m)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = 0;
+            for (size_t j = 0; j < n; j++)
+            {
+                F(i, j) = Ft(j, i) = (i == j) + 0.01 * value(i, j);
+                P(i, j) = i == j;
+                Q(i, j) = i == j ? 1e-3 : 0;
+            }
+        }
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < n; j++)
+                H(i, j) = Ht(j, i) = value(i + 7, j);
+            for (size_t j = 0; j < m; j++)
+                R(i, j) = i == j ? 0.1 : 0;
+        }
+    }
+
+    void step(const size_t k)
+    {
+        x = F * x;
+        P = F * P * Ft + Q;
+        for (size_t i = 0; i < m; i++)
+            z[i] = 0.1 * value(k % 1000, i);
+        y = z - H * x;
+        S = H * P * Ht + R;
+        ldl.hold(S);
+        Sinv.holdInv(ldl);
+        K = P * Ht * Sinv;
+        x += K * y;
+        P -= K * H * P;
+    }
+};
+
+struct Report
+{
+    std::vector<double> latencies; // ns
+    size_t allocatingSteps = 0, lastAllocatingStep = 0;
+};
+
+template <typename Filter>
+Report run(Filter &filter, const size_t iterations)
+{
+    Report report;
+    report.latencies.resize(iterations);
+    for (size_t k = 0; k < iterations; k++)
+    {
+        const size_t allocated = internal::alloc_count;
+        const auto start = std::chrono::steady_clock::now();
+        filter.step(k);
+        report.latencies[k] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (internal::alloc_count != allocated)
+        {
+            report.allocatingSteps++;
+            report.lastAllocatingStep = k;
+        }
+    }
+    return report;
+}
+
+double percentile(const std::vector<double> &sorted, const double p)
+{
+    return sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+}
+
+void print(const char *name, const size_t n, const size_t m, const Report &report)
+{
+    const std::vector<double> &l = report.latencies;
+    double warmSum = 0;
+    for (size_t k = 0; k < warmUp && k < l.size(); k++)
+        warmSum += l[k];
+    std::vector<double> steady(l.begin() + std::min(warmUp, l.size()), l.end());
+    if (steady.empty())
+        steady = l;
+    double sum = 0, sum2 = 0;
+    for (size_t k = 0; k < steady.size(); k++)
+    {
+        sum += steady[k];
+        sum2 += steady[k] * steady[k];
+    }
+    const double mean = sum / steady.size();
+    std::sort(steady.begin(), steady.end());
+
+    printf("\n%s, n = %zu, m = %zu, %zu iterations\n", name, n, m, l.size());
+    printf("  warm-up      : first %.0f ns, mean of the first %zu %.0f ns, %zu allocating steps (last one: %zu)\n", l[0], std::min(warmUp, l.size()), warmSum / std::min(warmUp, l.size()), report.allocatingSteps, report.lastAllocatingStep);
+    printf("  steady state : mean %.0f ns, std %.0f ns, p50 %.0f ns, p99 %.0f ns, p99.9 %.0f ns, max %.0f ns\n",
+           mean, sqrt(std::max(0.0, sum2 / steady.size() - mean * mean)), percentile(steady, 0.5), percentile(steady, 0.99), percentile(steady, 0.999), steady.back());
+
+    // histogram with 4 logarithmic buckets per octave
+    const double ratio = pow(2, 0.25);
+    double low = steady.front();
+    size_t k = 0;
+    while (k < steady.size())
+    {
+        const double high = low * ratio;
+        size_t count = 0;
+        while (k < steady.size() && steady[k] < high)
+        {
+            count++;
+            k++;
+        }
+        if (count)
+        {
+            const double share = (double)count / steady.size();
+            printf("  [%9.0f, %9.0f) ns %9zu %7.3f%% ", low, high, count, 100 * share);
+            for (size_t bar = 0; bar < share * 50; bar++)
+                printf("#");
+            printf("\n");
+        }
+        low = high;
+    }
+}
+
+// largest difference so far, NaN (diverged filter) as soon as one of the values is not finite
+double maxDifference(const double error, const double a, const double b)
+{
+    if (!std::isfinite(a) || !std::isfinite(b) || error != error)
+        return NAN;
+    return std::max(error, fabs(a - b));
+}
+
+// runs both filters for a few steps and returns the largest difference of their states and covariances
+template <typename T>
+double compare(const size_t n, const size_t m, const size_t steps)
+{
+    PackedFilter<T> packed(n, m);
+    OperatorFilter<T> dense(n, m);
+    for (size_t k = 0; k < steps; k++)
+    {
+        packed.step(k);
+        dense.step(k);
+    }
+    double error = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        error = maxDifference(error, packed.x[i], dense.x[i]);
+        for (size_t j = 0; j <= i; j++)
+            error = maxDifference(error, packed.P(i, j), dense.P(i, j));
+    }
+    return error;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    const size_t shapes[][2] = {{6, 3}, {15, 6}};
+    for (const auto &shape : shapes)
+    {
+        // both implementations must compute the same filter before their latencies are compared
+        const double error = compare<float>(shape[0], shape[1], 100);
+        printf("n = %zu, m = %zu: largest difference of x and P between the two filters after 100 steps %g\n", shape[0], shape[1], error);
+        if (!(error < 1e-5))
+        {
+            printf("the filters disagree\n");
+            return 1;
+        }
+        PackedFilter<float> packed(shape[0], shape[1]);
+        print("hold* kernels, packed covariance, float", shape[0], shape[1], run(packed, iterations));
+        OperatorFilter<float> dense(shape[0], shape[1]);
+        print("operators, dense covariance, float", shape[0], shape[1], run(dense, iterations));
+    }
+    return 0;
+}
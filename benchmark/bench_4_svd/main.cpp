@@ -0,0 +1,88 @@
+/*
+times the one-sided Jacobi svd (singular values only, thin and full decompositions, pseudo-inverse) on the shapes of the calibration
+problems, 6 to 60 unknowns with as many or 4 times as many equations, for float and double, on one thread and on all of them
+pio run -e bench_svd -t exec
+*/
+
+#include <linearAlgebra.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+// runs f until at least 50ms elapsed, returns the mean time of one run in ns
+template <typename F>
+double timeIt(F f)
+{
+    size_t runs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    do
+    {
+        f();
+        runs++;
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 5e7);
+    return elapsed / runs;
+}
+
+// deterministic values in [-1, 1]
+double value(const size_t i, const size_t j)
+{
+    return ((i * 7919 + j * 104729) % 2001) / 1000.0 - 1.0;
+}
+
+// largest |a - U * diag(s) * V^T| relative to the largest singular value
+template <typename T>
+double residual(const rowMajorMatrix<T> &a, const Vector<T> &s, const rowMajorMatrix<T> &U, const rowMajorMatrix<T> &V)
+{
+    double worst = 0;
+    for (size_t i = 0; i < a.rows(); i++)
+        for (size_t j = 0; j < a.cols(); j++)
+        {
+            double r = a.begin()[i * a.cols() + j];
+            for (size_t k = 0; k < s.size(); k++)
+                r -= (double)U.begin()[i * U.cols() + k] * s.begin()[k] * V.begin()[j * V.cols() + k];
+            worst = std::max(worst, fabs(r));
+        }
+    return worst / s.begin()[0];
+}
+
+template <typename T>
+void bench(const char *type, const size_t rows, const size_t cols, const size_t threads)
+{
+    rowMajorMatrix<T> a(rows, cols), U, V, X;
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            a(i, j) = (i % cols == j) + 0.5 * value(i, j);
+    svd<T> decomposition(rows, cols);
+    Vector<T> s;
+    setThreadCount(threads);
+    decomposition.compute(s, U, V, a, svd<T>::mode::full);
+    decomposition.pinv(X, a);
+    const size_t allocated = internal::alloc_count;
+    const double values = timeIt([&]() { decomposition.singularValues(s, a); });
+    const double full = timeIt([&]() { decomposition.compute(s, U, V, a, svd<T>::mode::full); });
+    const double thin = timeIt([&]() { decomposition.compute(s, U, V, a); });
+    const double pinv = timeIt([&]() { decomposition.pinv(X, a); });
+    setThreadCount(1);
+    printf("%-6s %4zu x %-3zu %7zu %12.1f %12.1f %12.1f %12.1f %10.1e %10s\n", type, rows, cols, threads, values / 1e3, thin / 1e3, full / 1e3, pinv / 1e3,
+           residual(a, s, U, V), internal::alloc_count == allocated ? "none" : "yes");
+}
+
+int main()
+{
+    const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const size_t columns[] = {6, 12, 24, 40, 60};
+    printf("%-6s %-10s %7s %12s %12s %12s %12s %10s %10s\n", "type", "shape", "threads", "values us", "thin us", "full us", "pinv us", "residual", "allocation");
+    for (const size_t cols : columns)
+        for (size_t rows = cols; rows <= 4 * cols; rows += 3 * cols)
+        {
+            bench<float>("float", rows, cols, 1);
+            bench<double>("double", rows, cols, 1);
+            if (hardware > 1)
+                bench<double>("double", rows, cols, hardware);
+        }
+    return 0;
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACCOUNTING_HPP
+#define ACCOUNTING_HPP
+
+// Optional FLOP and memory traffic accounting, compiled only when LINEAR_ALGEBRA_ACCOUNTING is defined (e.g. build_flags = -DLINEAR_ALGEBRA_ACCOUNTING),
+// otherwise the hooks expand to nothing.
+// Each kernel of src/*.cpp adds to its own counter (one per instantiation) the number of calls, its duration and its analytic cost :
+// floating point operations (a multiply-add counts 2) and bytes of the stored elements read and written, so a packed symMatrix
+// or triangular operand of order n counts n(n+1)/2 elements. Nested kernels are counted by themselves and by their caller (inclusive).
+// accounting::report() places each kernel on a roofline : arithmetic intensity, achieved GFLOP/s and GB/s, attainable GFLOP/s.
+
+#include "trace.hpp"
+
+#ifdef LINEAR_ALGEBRA_ACCOUNTING
+
+#include <string.h>
+#include <ctype.h>
+#include <stdio.h>
+
+template <typename T>
+class Vector;
+template <typename T>
+class csrMatrix;
+template <typename T>
+class cscMatrix;
+
+namespace accounting
+{
+    class counter
+    {
+    public:
+        const char *const kernel; // __PRETTY_FUNCTION__ of the kernel
+        std::atomic<uint64_t> calls, flops, bytesRead, bytesWritten, ticks;
+        counter *const next;
+        explicit counter(const char *kernel) : kernel(kernel), calls(0), flops(0), bytesRead(0), bytesWritten(0), ticks(0), next(push(this)) {}
+        // first counter of the list of all the kernels called so far
+        static counter *first() noexcept { return head().load(std::memory_order_acquire); }
+
+    private:
+        static std::atomic<counter *> &head() noexcept { static std::atomic<counter *> h(nullptr); return h; }
+        static counter *push(counter *c) noexcept
+        {
+            counter *old = head().load(std::memory_order_relaxed);
+            // c->next is set by the constructor from the returned value, before c is published
+            while (!head().compare_exchange_weak(old, c, std::memory_order_release, std::memory_order_relaxed))
+                ;
+            return old;
+        }
+    };
+
+    // adds the cost given on construction and the duration to the counter on destruction
+    class scope
+    {
+    private:
+        counter &c;
+        const uint32_t start;
+
+    public:
+        scope(counter &c, const uint64_t flops, const uint64_t bytesRead, const uint64_t bytesWritten) noexcept : c(c), start(trace::now())
+        {
+            c.calls.fetch_add(1, std::memory_order_relaxed);
+            c.flops.fetch_add(flops, std::memory_order_relaxed);
+            c.bytesRead.fetch_add(bytesRead, std::memory_order_relaxed);
+            c.bytesWritten.fetch_add(bytesWritten, std::memory_order_relaxed);
+        }
+        ~scope() { c.ticks.fetch_add(trace::now() - start, std::memory_order_relaxed); }
+    };
+
+    inline void reset() noexcept
+    {
+        for (counter *c = counter::first(); c; c = c->next)
+        {
+            c->calls = 0;
+            c->flops = 0;
+            c->bytesRead = 0;
+            c->bytesWritten = 0;
+            c->ticks = 0;
+        }
+    }
+
+    // analytic costs used by the kernels
+    // number of elements of a packed triangle of order n
+    inline uint64_t packed(const uint64_t n) noexcept { return n * (n + 1) / 2; }
+    // bytes of the stored elements, and of the indices of the sparse matrices
+    template <typename U> uint64_t bytes(const Vector<U> &x) noexcept { return (uint64_t)x.size() * sizeof(U); }
+    template <typename U> uint64_t bytes(const csrMatrix<U> &x) noexcept { return (uint64_t)x.size() * (sizeof(U) + sizeof(size_t)) + (x.rows() + 1) * sizeof(size_t); }
+    template <typename U> uint64_t bytes(const cscMatrix<U> &x) noexcept { return (uint64_t)x.size() * (sizeof(U) + sizeof(size_t)) + (x.cols() + 1) * sizeof(size_t); }
+    // sum of the orders of the blocks of a blockDiagMatrix to the power p
+    template <typename M> uint64_t blockSum(const M &a, const unsigned p) noexcept
+    {
+        uint64_t sum = 0;
+        for (size_t k = 0; k < a.blocks(); k++)
+        {
+            uint64_t term = 1;
+            for (unsigned i = 0; i < p; i++)
+                term *= a.blockOrder(k);
+            sum += term;
+        }
+        return sum;
+    }
+    // operations of a*b*a^T for a csrMatrix a, only the lower part being computed
+    template <typename M> uint64_t sandwich(const M &a) noexcept
+    {
+        uint64_t flops = 0, lower = 0;
+        for (size_t i = 0; i < a.rows(); i++)
+        {
+            const uint64_t nnz = a.rowEnd(i) - a.rowBegin(i);
+            lower += 2 * nnz + 2;
+            flops += nnz * lower;
+        }
+        return flops;
+    }
+
+    namespace internal
+    {
+        // value of the template parameter name in the " [with U = float; T = float]" clause of a __PRETTY_FUNCTION__, nullptr if absent
+        inline const char *parameter(const char *with, const char *name, const size_t length, size_t &valueLength)
+        {
+            for (const char *p = with + 7;;)
+            {
+                const char *equal = strstr(p, " = ");
+                if (!equal)
+                    return nullptr;
+                const char *end = equal + 3;
+                while (*end && *end != ';' && *end != ']')
+                    end++;
+                if ((size_t)(equal - p) == length && !strncmp(p, name, length))
+                {
+                    valueLength = end - equal - 3;
+                    return equal + 3;
+                }
+                if (*end != ';')
+                    return nullptr;
+                p = end + 2;
+            }
+        }
+
+        // "Derived<T>* Derived<T>::kernel(const A<U>&, const B<V>&, bool, bool) [with U = float; V = float; T = float]"
+        // -> "Derived<float>::kernel(A<float>, B<float>)"
+        inline void shortName(const char *pretty, char *out, const size_t size)
+        {
+            const char *with = strstr(pretty, " [with ");
+            const char *end = with ? with : pretty + strlen(pretty);
+            // the return type is before the last space preceding the parameters
+            const char *begin = strchr(pretty, '(');
+            if (!begin || begin > end)
+                begin = end;
+            while (begin > pretty && begin[-1] != ' ')
+                begin--;
+            size_t n = 0;
+            for (const char *p = begin; p < end && n + 1 < size;)
+            {
+                if (!strncmp(p, "const ", 6))
+                    p += 6;
+                else if (!strncmp(p, ", bool", 6))
+                    p += 6;
+                else if (!strncmp(p, "bool", 4) && p[-1] == '(')
+                    p += 4;
+                else if (*p == '&')
+                    p++;
+                else if (isalpha((unsigned char)*p) || *p == '_')
+                {
+                    const char *identifier = p;
+                    while (p < end && (isalnum((unsigned char)*p) || *p == '_'))
+                        p++;
+                    size_t length = p - identifier, valueLength = 0;
+                    const char *value = with ? parameter(with, identifier, length, valueLength) : nullptr;
+                    if (value)
+                        length = valueLength;
+                    else
+                        value = identifier;
+                    for (size_t i = 0; i < length && n + 1 < size; i++)
+                        out[n++] = value[i];
+                }
+                else
+                    out[n++] = *p++;
+            }
+            out[n] = 0;
+        }
+    } // namespace internal
+
+    // one line per kernel called since the last reset, the most time consuming first :
+    // calls, FLOP and bytes per call, arithmetic intensity (FLOP/byte), time per call, achieved GFLOP/s and GB/s,
+    // and attainable GFLOP/s = min(peakGflops, intensity * bandwidthGBs), the roofline of the machine.
+    // The peak and the bandwidth default to the best values achieved by the kernels (empirical roofline).
+    inline String report(double peakGflops = 0, double bandwidthGBs = 0)
+    {
+        const double ticksPerNs = trace::ticksPerUs() / 1000.0;
+        double bestGflops = 0, bestGBs = 0;
+        int width = 6;
+        char line[384], name[192];
+        for (counter *c = counter::first(); c; c = c->next)
+        {
+            if (!c->calls)
+                continue;
+            internal::shortName(c->kernel, name, sizeof(name));
+            if ((int)strlen(name) > width)
+                width = (int)strlen(name);
+            if (!c->ticks)
+                continue;
+            const double ns = c->ticks / ticksPerNs;
+            if (c->flops / ns > bestGflops)
+                bestGflops = c->flops / ns;
+            if ((c->bytesRead + c->bytesWritten) / ns > bestGBs)
+                bestGBs = (c->bytesRead + c->bytesWritten) / ns;
+        }
+        if (peakGflops <= 0)
+            peakGflops = bestGflops;
+        if (bandwidthGBs <= 0)
+            bandwidthGBs = bestGBs;
+        snprintf(line, sizeof(line), "roofline : peak %.3f GFLOP/s, bandwidth %.3f GB/s, ridge %.3f FLOP/byte\n", peakGflops, bandwidthGBs, bandwidthGBs > 0 ? peakGflops / bandwidthGBs : 0);
+        String s = line;
+        snprintf(line, sizeof(line), "%-*s %10s %12s %12s %9s %11s %9s %9s %9s %6s %s\n", width, "kernel", "calls", "FLOP/call", "bytes/call", "FLOP/byte", "us/call", "GFLOP/s", "GB/s", "roof", "%roof", "bound");
+        s += line;
+        // by decreasing time, ties broken by address
+        const counter *previous = nullptr;
+        while (true)
+        {
+            const counter *best = nullptr;
+            for (const counter *c = counter::first(); c; c = c->next)
+            {
+                if (!c->calls)
+                    continue;
+                if (previous && (c->ticks > previous->ticks || (c->ticks == previous->ticks && c >= previous)))
+                    continue;
+                if (!best || c->ticks > best->ticks || (c->ticks == best->ticks && c > best))
+                    best = c;
+            }
+            if (!best)
+                break;
+            previous = best;
+            const double calls = (double)best->calls;
+            const double flops = (double)best->flops;
+            const double bytes = (double)(best->bytesRead + best->bytesWritten);
+            const double ns = best->ticks / ticksPerNs;
+            const double intensity = bytes > 0 ? flops / bytes : 0;
+            const double gflops = ns > 0 ? flops / ns : 0;
+            const double roof = bytes > 0 && intensity * bandwidthGBs < peakGflops ? intensity * bandwidthGBs : peakGflops;
+            internal::shortName(best->kernel, name, sizeof(name));
+            snprintf(line, sizeof(line), "%-*s %10llu %12.0f %12.0f %9.3f %11.3f %9.3f %9.3f %9.3f %6.1f %s\n", width, name, (unsigned long long)best->calls,
+                     flops / calls, bytes / calls, intensity, ns / calls / 1000, gflops, ns > 0 ? bytes / ns : 0, roof,
+                     roof > 0 ? 100 * gflops / roof : 0, bytes > 0 && intensity * bandwidthGBs < peakGflops ? "memory" : "compute");
+            s += line;
+        }
+        return s;
+    }
+} // namespace accounting
+
+// counts the enclosing kernel, e.g. LINEAR_ALGEBRA_ACCOUNT(2 * a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), a.rows() * b.cols() * sizeof(T));
+#define LINEAR_ALGEBRA_ACCOUNT(flops, bytesRead, bytesWritten)                \
+    static accounting::counter _accountCounter(__PRETTY_FUNCTION__);          \
+    accounting::scope _accountScope(_accountCounter, flops, bytesRead, bytesWritten)
+
+#else
+
+#define LINEAR_ALGEBRA_ACCOUNT(flops, bytesRead, bytesWritten)
+
+#endif // LINEAR_ALGEBRA_ACCOUNTING
+
+#endif // ACCOUNTING_HPP
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef BAND_MATRIX_HPP
+#define BAND_MATRIX_HPP
+
+#include "matrixBase.hpp"
+#include "rowMajorMatrix.hpp"
+
+// band matrix : only the elements such that -kl <= j-i <= ku are stored.
+// Each row holds kl+ku+1 elements, the element (i,j) is at i*(kl+ku+1) + j-i+kl.
+// The slots that fall outside the matrix (first and last rows) are never read.
+template <typename T>
+class bandMatrix : public MatrixBase<T>
+{
+    friend class internal::tmp<bandMatrix>;
+    template <typename U> friend class Vector;
+    template <typename U> friend class rowMajorMatrix;
+    template <typename U> friend class bandMatrix;
+
+protected:
+    size_t _kl = 0;
+    size_t _ku = 0;
+    bandMatrix *swap(bandMatrix &other) noexcept;
+    const size_t minMemorySize(const size_t rows, const size_t cols, const size_t kl, const size_t ku) const noexcept { return rows * (kl + ku + 1); }
+    virtual const size_t minMemorySize(const size_t rows, const size_t cols) const noexcept override { return minMemorySize(rows, cols, _kl, _ku); }
+    static const bandMatrix<T> staticHelper;
+    const size_t width() const noexcept { return _kl + _ku + 1; }
+
+public:
+    bandMatrix() : MatrixBase<T>() {}
+    bandMatrix(const size_t rows, const size_t cols, const size_t kl, const size_t ku) : MatrixBase<T>() { resize(rows, cols, kl, ku); }
+    bandMatrix(const size_t order, const size_t bandwidth) : bandMatrix(order, order, bandwidth, bandwidth) {}
+
+    const size_t lowerBandwidth() const noexcept { return _kl; }
+    const size_t upperBandwidth() const noexcept { return _ku; }
+    bool inBand(const size_t row, const size_t col) const noexcept { return row <= col + _kl && col <= row + _ku; }
+
+    // throw if the element is outside the band
+    virtual T &operator()(const size_t row, const size_t col) override;
+    const T &operator()(const size_t row, const size_t col) const override { return inBand(row, col) ? this->_begin[row * width() + col + _kl - row] : internal::_zero<T>; }
+
+    // keep the bandwidths
+    virtual bandMatrix *resize(const size_t rows, const size_t cols, const bool deallocIfPossible = false, const bool saveData = true) override { return resize(rows, cols, _kl, _ku, deallocIfPossible, saveData); }
+    bandMatrix *resize(const size_t rows, const size_t cols, const size_t kl, const size_t ku, const bool deallocIfPossible = false, const bool saveData = true);
+
+    // bandMatrix and bandMatrix
+    bandMatrix *hold(const bandMatrix &other, const bool checkSize = true);
+    // rowMajorMatrix : the elements outside the band are ignored
+    template <typename U> bandMatrix *hold(const rowMajorMatrix<U> &other, const bool checkSize = true);
+
+    // LDL^T factorization of a symmetric band matrix (only its lower band is read), in O(n*kl^2)
+    // the result has kl = a.kl and ku = 0 : the strictly lower band holds L and the diagonal holds D
+    template <typename U, typename A = typename internal::accumulator<T>::type> bandMatrix *holdLDL(const bandMatrix<U> &a, const bool checkSize = true);
+
+    ////////////////////////// operators //////////////////////////
+    // dataType
+    bandMatrix *operator*=(const T &data) { return (bandMatrix *)this->Vector<T>::operator*=(data); };
+    bandMatrix *operator/=(const T &data) { return (bandMatrix *)this->Vector<T>::operator/=(data); };
+    // bandMatrix
+    bandMatrix *operator=(const bandMatrix &other) { return this->hold(other, operators::MatrixCheckSize); };
+    bandMatrix *operator=(internal::tmp<bandMatrix> &&other) noexcept { return this->swap(*other.release()); };
+};
+
+namespace operators
+{
+    // bandMatrix and rowMajorMatrix
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const bandMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const bandMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+}
+
+#ifndef BAND_MATRIX_CPP
+#include "bandMatrix.cpp"
+#endif
+
+#endif // BAND_MATRIX_HPP
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLOCK_DIAG_MATRIX_HPP
+#define BLOCK_DIAG_MATRIX_HPP
+
+#include "matrixBase.hpp"
+#include "rowMajorMatrix.hpp"
+#include "symMatrix.hpp"
+
+// block diagonal matrix : square blocks along the diagonal, the elements outside the blocks are zeros.
+// The blocks are stored one after the other in the Vector storage, either dense (row-major) or symmetric (packed lower part).
+template <typename T>
+class blockDiagMatrix : public MatrixBase<T>
+{
+    friend class internal::tmp<blockDiagMatrix>;
+    template <typename U> friend class Vector;
+    template <typename U> friend class rowMajorMatrix;
+    template <typename U> friend class blockDiagMatrix;
+
+protected:
+    // for the block k : first row (and column) in _blockStart[k], first element in the storage in _blockOffset[k]
+    // both have blocks()+1 entries, the last one being the order (the storage size) of the whole matrix
+    Vector<size_t> _blockStart;
+    Vector<size_t> _blockOffset;
+    Vector<bool> _blockSym;
+    blockDiagMatrix *swap(blockDiagMatrix &other) noexcept;
+    // the storage depends on the blocks, not on the shape
+    virtual const size_t minMemorySize(const size_t rows, const size_t cols) const noexcept override { return 0; }
+    static const blockDiagMatrix<T> staticHelper;
+    const size_t findBlock(const size_t index) const noexcept;
+    const size_t localIndex(const size_t block, const size_t row, const size_t col) const noexcept;
+    T *appendBlock(const size_t order, const bool symmetric);
+
+public:
+    blockDiagMatrix() : MatrixBase<T>() { clear(); }
+    blockDiagMatrix(const size_t rows, const size_t cols) : MatrixBase<T>() { resize(rows, cols); }
+
+    const size_t blocks() const noexcept { return _blockSym.size(); }
+    const size_t blockStart(const size_t block) const noexcept { return _blockStart[block]; }
+    const size_t blockOrder(const size_t block) const noexcept { return _blockStart[block + 1] - _blockStart[block]; }
+    bool isSymmetric(const size_t block) const noexcept { return _blockSym[block]; }
+
+    // throw if the element is outside the blocks
+    virtual T &operator()(const size_t row, const size_t col) override;
+    const T &operator()(const size_t row, const size_t col) const override;
+
+    // remove all the blocks
+    blockDiagMatrix *clear();
+    // a single dense block
+    virtual blockDiagMatrix *resize(const size_t rows, const size_t cols, const bool deallocIfPossible = false, const bool saveData = true) override;
+    // append a block of zeros on the diagonal
+    blockDiagMatrix *addBlock(const size_t order, const bool symmetric = false);
+    // append a copy of a square matrix on the diagonal
+    template <typename U> blockDiagMatrix *addBlock(const rowMajorMatrix<U> &block);
+    template <typename U> blockDiagMatrix *addBlock(const symMatrix<U> &block);
+
+    // blockDiagMatrix and blockDiagMatrix
+    blockDiagMatrix *hold(const blockDiagMatrix &other);
+
+    // LDL^T factorization of each block (only the lower part of the dense blocks is read), the blocks of the result are packed :
+    // the strictly lower part holds L and the diagonal holds D
+    template <typename U, typename A = typename internal::accumulator<T>::type> blockDiagMatrix *holdLDL(const blockDiagMatrix<U> &a);
+
+    ////////////////////////// operators //////////////////////////
+    // dataType
+    blockDiagMatrix *operator*=(const T &data) { return (blockDiagMatrix *)this->Vector<T>::operator*=(data); };
+    blockDiagMatrix *operator/=(const T &data) { return (blockDiagMatrix *)this->Vector<T>::operator/=(data); };
+    // blockDiagMatrix
+    blockDiagMatrix *operator=(const blockDiagMatrix &other) { return this->hold(other); };
+    blockDiagMatrix *operator=(internal::tmp<blockDiagMatrix> &&other) noexcept { return this->swap(*other.release()); };
+};
+
+namespace operators
+{
+    // blockDiagMatrix and rowMajorMatrix
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const blockDiagMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const blockDiagMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+}
+
+#ifndef BLOCK_DIAG_MATRIX_CPP
+#include "blockDiagMatrix.cpp"
+#endif
+
+#endif // BLOCK_DIAG_MATRIX_HPP
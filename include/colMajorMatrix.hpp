@@ -58,21 +58,21 @@ class colMajorMatrix : public MatrixBase<T>
         template<typename U> colMajorMatrix<T> *hold(const colMajorMatrix<U> &other, const bool checkSize = true){ return (colMajorMatrix *)(checkSize? MatrixBase<T>::resizeLike(other):this)->Vector<T>::hold(other, false); };
         template<typename U, typename V> colMajorMatrix<T> *holdAdd(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true){ return (colMajorMatrix<T> *)(checkSize? MatrixBase<T>::checkSize_add(a,b):this)->Vector<T>::holdAdd(a, b, false); };
         template<typename U, typename V> colMajorMatrix<T> *holdSub(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true){ return (colMajorMatrix<T> *)(checkSize? MatrixBase<T>::checkSize_add(a,b):this)->Vector<T>::holdSub(a, b, false); };
-        template<typename U, typename V> colMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> colMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         
 
         // rowMajorMatrix and rowMajorMatrix
         template<typename U> colMajorMatrix<T> *hold(const rowMajorMatrix<U> &other, const bool checkSize = true);
         template<typename U, typename V> colMajorMatrix<T> *holdAdd(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> colMajorMatrix<T> *holdSub(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
-        template<typename U, typename V> colMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> colMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
 
         // colMajorMatrix and rowMajorMatrix
         template<typename U, typename V> colMajorMatrix<T> *holdAdd(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> colMajorMatrix<T> *holdSub(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> colMajorMatrix<T> *holdSub(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
-        template<typename U, typename V> colMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
-        template<typename U, typename V> colMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> colMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> colMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
 
 
         ////////////////////////// operators //////////////////////////
@@ -123,7 +123,7 @@ namespace operators
     // colMajorMatrix and colMajorMatrix
     template<typename T, typename U, typename V = decltype(T() + U())> internal::tmp<colMajorMatrix<V>> &&operator+(const colMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U, typename V = decltype(T() - U())> internal::tmp<colMajorMatrix<V>> &&operator-(const colMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<colMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<colMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
     // dataType and tmp colMajorMatrix
     template<typename T, typename U> internal::tmp<colMajorMatrix<U>> &&operator+(const T &a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<U>>*)b.holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<colMajorMatrix<U>> &&operator+(internal::tmp<colMajorMatrix<U>> &&a, const T &b) { return internal::move(*(internal::tmp<colMajorMatrix<U>>*)a.holdAdd(a, b, operators::MatrixCheckSize)); };
@@ -136,12 +136,12 @@ namespace operators
     template<typename T, typename U> internal::tmp<colMajorMatrix<U>> &&operator+(const colMajorMatrix<T> &a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<U>>*)b.holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<colMajorMatrix<T>> &&operator-(internal::tmp<colMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<T>>*)a.holdSub(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<colMajorMatrix<U>> &&operator-(const colMajorMatrix<T> &a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<U>>*)b.holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<colMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<colMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<V>> *)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<colMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<colMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<V>> *)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize)); };
     // tmp colMajorMatrix and tmp colMajorMatrix
     template<typename T, typename U> internal::tmp<colMajorMatrix<T>> &&operator+(internal::tmp<colMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<T>>*)a.holdAdd(a, *b.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<colMajorMatrix<T>> &&operator-(internal::tmp<colMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<T>>*)a.holdSub(a, *b.release(), operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<colMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<colMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<colMajorMatrix<V>>*)internal::tmp<colMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize)); };
 
     // tmp colMajorMatrix and rowMajorMatrix
     template<typename T, typename U> internal::tmp<colMajorMatrix<T>> &&operator+(internal::tmp<colMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<colMajorMatrix<T>>*)a.holdAdd(a, b, operators::MatrixCheckSize)); };
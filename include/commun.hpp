@@ -21,6 +21,7 @@
 #ifndef COMMUN_HPP
 #define COMMUN_HPP
 
+#include <stdint.h>
 #ifdef NATIVE
 #include <iostream>
 // typedef unsigned long long size_t;
@@ -30,6 +31,8 @@ typedef std::string String;
 #else
 #include <Arduino.h>
 #endif
+#include "trace.hpp"
+#include "accounting.hpp"
 
 
 template <typename T = float>
@@ -44,7 +47,6 @@ class symMatrix;
 
 namespace internal
 {
-    // float InvSqrt43 (float x);
     static size_t vec_count = 0;
     static size_t alloc_count = 0;
     template <typename T> T &&move(T &a) noexcept;
@@ -53,6 +55,17 @@ namespace internal
     class tmp;
     template <typename T> static const T _zero = T();
     template <typename T> static const T _one = T(1);
+
+    // type used by the kernels to accumulate the products (dot products, matrix products, factorizations) before storing the result as T.
+    // Each kernel takes it as last template argument, e.g. y.holdMul<float, float, double>(A, x),
+    // or it can be specialized once for all the kernels, e.g. namespace internal { template <> struct accumulator<float> { typedef double type; }; }
+    template <typename T> struct accumulator { typedef T type; };
+    template <> struct accumulator<int8_t> { typedef int32_t type; };
+    template <> struct accumulator<int16_t> { typedef int32_t type; };
+    template <> struct accumulator<uint8_t> { typedef uint32_t type; };
+    template <> struct accumulator<uint16_t> { typedef uint32_t type; };
+    // type used by the operators to store the product of two values, decltype(T()*U()) unless this product is an intermediate wider type (fixed-point numbers)
+    template <typename T> struct storage { typedef T type; };
 } // namespace internal;
 
 namespace operators
@@ -61,6 +74,9 @@ namespace operators
     static bool MatrixCheckSize = true;
 } // namespace operators
 
+#include "sort.hpp"
+#include "reduction.hpp"
+#include "fastMath.hpp"
 
 #include "vector.hpp"
 namespace internal
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSC_MATRIX_HPP
+#define CSC_MATRIX_HPP
+
+#include "matrixBase.hpp"
+#include "rowMajorMatrix.hpp"
+
+// compressed sparse column matrix : only the non-zero values are stored, column after column, in the Vector storage.
+// _colPtr[j] .. _colPtr[j+1] gives the range of the stored values of the column j, and _rowIndex the row of each of them.
+// push_back() only keeps the pointers up to the end of the last given column up to date, the ones of the skipped columns are filled at the
+// next column change and the following ones stay lower or equal to the number of values, so that the columns not given yet read as empty.
+template <typename T>
+class cscMatrix : public MatrixBase<T>
+{
+    friend class internal::tmp<cscMatrix>;
+    template <typename U> friend class Vector;
+    template <typename U> friend class rowMajorMatrix;
+    template <typename U> friend class symMatrix;
+    template <typename U> friend class cscMatrix;
+
+protected:
+    Vector<size_t> _colPtr;
+    Vector<size_t> _rowIndex;
+    // last column given to push_back()
+    size_t _lastCol = 0;
+    cscMatrix *swap(cscMatrix &other) noexcept;
+    // the storage depends on the number of non-zero values, not on the shape
+    virtual const size_t minMemorySize(const size_t rows, const size_t cols) const noexcept override { return 0; }
+    static const cscMatrix<T> staticHelper;
+    // returned by find() for an element that is not stored
+    static const size_t npos = (size_t)-1;
+    const size_t find(const size_t row, const size_t col) const noexcept;
+
+public:
+    cscMatrix() : MatrixBase<T>() {}
+    cscMatrix(const size_t rows, const size_t cols) : MatrixBase<T>() { resize(rows, cols); }
+    template <typename U> cscMatrix(const rowMajorMatrix<U> &dense, const T &threshold = 0) : MatrixBase<T>() { hold(dense, threshold); }
+
+    const size_t nonZeros() const noexcept { return this->size(); }
+    const size_t colBegin(const size_t col) const noexcept { return col > _lastCol ? this->size() : _colPtr[col]; }
+    const size_t colEnd(const size_t col) const noexcept { return col >= _lastCol ? this->size() : _colPtr[col + 1]; }
+    const size_t rowIndex(const size_t index) const noexcept { return _rowIndex[index]; }
+
+    // throw if the element is not part of the sparsity structure
+    virtual T &operator()(const size_t row, const size_t col) override;
+    const T &operator()(const size_t row, const size_t col) const override;
+
+    // empty the structure (all the elements become zeros)
+    virtual cscMatrix *resize(const size_t rows, const size_t cols, const bool deallocIfPossible = false, const bool saveData = true) override;
+    // append a non-zero value, the elements have to be given in column-major order (amortized constant time)
+    cscMatrix *push_back(const size_t row, const size_t col, const T &value);
+
+    // cscMatrix and cscMatrix
+    cscMatrix *hold(const cscMatrix &other);
+    // rowMajorMatrix : only the elements whose absolute value is greater than the threshold are stored
+    template <typename U> cscMatrix *hold(const rowMajorMatrix<U> &dense, const T &threshold = 0);
+
+    ////////////////////////// operators //////////////////////////
+    // dataType
+    cscMatrix *operator*=(const T &data) { return (cscMatrix *)this->Vector<T>::operator*=(data); };
+    cscMatrix *operator/=(const T &data) { return (cscMatrix *)this->Vector<T>::operator/=(data); };
+    // cscMatrix
+    cscMatrix *operator=(const cscMatrix &other) { return this->hold(other); };
+    cscMatrix *operator=(internal::tmp<cscMatrix> &&other) noexcept { return this->swap(*other.release()); };
+    // rowMajorMatrix
+    template <typename U> cscMatrix *operator=(const rowMajorMatrix<U> &other) { return this->hold(other); };
+};
+
+namespace operators
+{
+    // rowMajorMatrix and cscMatrix
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const cscMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const cscMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+}
+
+#ifndef CSC_MATRIX_CPP
+#include "cscMatrix.cpp"
+#endif
+
+#endif // CSC_MATRIX_HPP
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSR_MATRIX_HPP
+#define CSR_MATRIX_HPP
+
+#include "matrixBase.hpp"
+#include "rowMajorMatrix.hpp"
+
+// compressed sparse row matrix : only the non-zero values are stored, row after row, in the Vector storage.
+// _rowPtr[i] .. _rowPtr[i+1] gives the range of the stored values of the row i, and _colIndex the column of each of them.
+// push_back() only keeps the pointers up to the end of the last given row up to date, the ones of the skipped rows are filled at the
+// next row change and the following ones stay lower or equal to the number of values, so that the rows not given yet read as empty.
+// Intended for the jacobians and state-transition matrices that are mostly made of zeros and whose structure does not change.
+template <typename T>
+class csrMatrix : public MatrixBase<T>
+{
+    friend class internal::tmp<csrMatrix>;
+    template <typename U> friend class Vector;
+    template <typename U> friend class rowMajorMatrix;
+    template <typename U> friend class symMatrix;
+    template <typename U> friend class csrMatrix;
+
+protected:
+    Vector<size_t> _rowPtr;
+    Vector<size_t> _colIndex;
+    // last row given to push_back()
+    size_t _lastRow = 0;
+    csrMatrix *swap(csrMatrix &other) noexcept;
+    // the storage depends on the number of non-zero values, not on the shape
+    virtual const size_t minMemorySize(const size_t rows, const size_t cols) const noexcept override { return 0; }
+    static const csrMatrix<T> staticHelper;
+    // returned by find() for an element that is not stored
+    static const size_t npos = (size_t)-1;
+    const size_t find(const size_t row, const size_t col) const noexcept;
+
+public:
+    csrMatrix() : MatrixBase<T>() {}
+    csrMatrix(const size_t rows, const size_t cols) : MatrixBase<T>() { resize(rows, cols); }
+    template <typename U> csrMatrix(const rowMajorMatrix<U> &dense, const T &threshold = 0) : MatrixBase<T>() { hold(dense, threshold); }
+
+    const size_t nonZeros() const noexcept { return this->size(); }
+    const size_t rowBegin(const size_t row) const noexcept { return row > _lastRow ? this->size() : _rowPtr[row]; }
+    const size_t rowEnd(const size_t row) const noexcept { return row >= _lastRow ? this->size() : _rowPtr[row + 1]; }
+    const size_t colIndex(const size_t index) const noexcept { return _colIndex[index]; }
+
+    // throw if the element is not part of the sparsity structure
+    virtual T &operator()(const size_t row, const size_t col) override;
+    const T &operator()(const size_t row, const size_t col) const override;
+
+    // empty the structure (all the elements become zeros)
+    virtual csrMatrix *resize(const size_t rows, const size_t cols, const bool deallocIfPossible = false, const bool saveData = true) override;
+    // append a non-zero value, the elements have to be given in row-major order (amortized constant time)
+    csrMatrix *push_back(const size_t row, const size_t col, const T &value);
+
+    // csrMatrix and csrMatrix
+    csrMatrix *hold(const csrMatrix &other);
+    // rowMajorMatrix : only the elements whose absolute value is greater than the threshold are stored
+    template <typename U> csrMatrix *hold(const rowMajorMatrix<U> &dense, const T &threshold = 0);
+
+    ////////////////////////// operators //////////////////////////
+    // dataType
+    csrMatrix *operator*=(const T &data) { return (csrMatrix *)this->Vector<T>::operator*=(data); };
+    csrMatrix *operator/=(const T &data) { return (csrMatrix *)this->Vector<T>::operator/=(data); };
+    // csrMatrix
+    csrMatrix *operator=(const csrMatrix &other) { return this->hold(other); };
+    csrMatrix *operator=(internal::tmp<csrMatrix> &&other) noexcept { return this->swap(*other.release()); };
+    // rowMajorMatrix
+    template <typename U> csrMatrix *operator=(const rowMajorMatrix<U> &other) { return this->hold(other); };
+};
+
+namespace operators
+{
+    // csrMatrix and rowMajorMatrix
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const csrMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const csrMatrix<T> &a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
+}
+
+#ifndef CSR_MATRIX_CPP
+#include "csrMatrix.cpp"
+#endif
+
+#endif // CSR_MATRIX_HPP
@@ -80,6 +80,7 @@ public:
 
     // other functionalities
     T det() const;
+    template <typename A = typename internal::accumulator<T>::type> A trace() const;
     template <typename U> diagMatrix *holdInv(const diagMatrix<U> &other, const bool checkSize = true) { return this->holdInv(1, other, checkSize); };
 
 };
@@ -109,7 +110,7 @@ namespace operators
     // diagMatrix and diagMatrix
     template <typename T, typename U, typename V=decltype(T()+U())> internal::tmp<diagMatrix<V>> &&operator+(const diagMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<diagMatrix<V>>*)internal::tmp<diagMatrix<V>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U, typename V=decltype(T()-U())> internal::tmp<diagMatrix<V>> &&operator-(const diagMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<diagMatrix<V>>*)internal::tmp<diagMatrix<V>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V=decltype(T()*U())> internal::tmp<diagMatrix<V>> &&operator*(const diagMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<diagMatrix<V>>*)internal::tmp<diagMatrix<V>>::get(a.rows(), a.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<diagMatrix<V>> &&operator*(const diagMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<diagMatrix<V>>*)internal::tmp<diagMatrix<V>>::get(a.rows(), a.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U, typename V=decltype(T()/U())> internal::tmp<diagMatrix<V>> &&operator/(const diagMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<diagMatrix<V>>*)internal::tmp<diagMatrix<V>>::get(a.rows(), a.cols())->holdDiv(a, b, operators::MatrixCheckSize)); };
     // diagMatrix and tmp diagMatrix
     template <typename T, typename U> internal::tmp<diagMatrix<U>> &&operator+(const diagMatrix<T> &a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<diagMatrix<U>>*)b.holdAdd(a, b, operators::MatrixCheckSize)); };
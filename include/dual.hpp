@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DUAL_HPP
+#define DUAL_HPP
+
+#include "commun.hpp"
+#include "rowMajorMatrix.hpp"
+#include <math.h>
+
+// Forward-mode automatic differentiation : dualN<T, W> carries a value and its derivatives along W directions,
+// each operation applying the chain rule to the W of them at once (a loop the compiler unrolls and vectorizes).
+// It is usable as T in Vector and the matrix classes, so a model written with them gives its derivatives exactly, for the cost of W + 1 evaluations at most.
+// dual<T> is the single direction case. The comparisons only look at the values.
+template <typename T, size_t W>
+class dualN
+{
+public:
+    T value;
+    T d[W];
+
+    dualN() noexcept : value(0) { for (size_t k = 0; k < W; k++) d[k] = 0; }
+    dualN(const T value) noexcept : value(value) { for (size_t k = 0; k < W; k++) d[k] = 0; }
+    // value with the derivative 1 along direction
+    static dualN variable(const T value, const size_t direction) noexcept { dualN r(value); r.d[direction] = 1; return r; }
+
+    dualN operator-() const noexcept { dualN r; r.value = -value; for (size_t k = 0; k < W; k++) r.d[k] = -d[k]; return r; }
+    dualN &operator+=(const dualN &o) noexcept { value += o.value; for (size_t k = 0; k < W; k++) d[k] += o.d[k]; return *this; }
+    dualN &operator-=(const dualN &o) noexcept { value -= o.value; for (size_t k = 0; k < W; k++) d[k] -= o.d[k]; return *this; }
+    dualN &operator*=(const dualN &o) noexcept { for (size_t k = 0; k < W; k++) d[k] = d[k] * o.value + value * o.d[k]; value *= o.value; return *this; }
+    dualN &operator/=(const dualN &o) noexcept
+    {
+        const T inverse = T(1) / o.value;
+        value *= inverse;
+        for (size_t k = 0; k < W; k++)
+            d[k] = (d[k] - value * o.d[k]) * inverse;
+        return *this;
+    }
+    dualN &operator+=(const T &o) noexcept { value += o; return *this; }
+    dualN &operator-=(const T &o) noexcept { value -= o; return *this; }
+    dualN &operator*=(const T &o) noexcept { value *= o; for (size_t k = 0; k < W; k++) d[k] *= o; return *this; }
+    dualN &operator/=(const T &o) noexcept { return *this *= T(1) / o; }
+
+    friend dualN operator+(dualN a, const dualN &b) noexcept { return a += b; }
+    friend dualN operator-(dualN a, const dualN &b) noexcept { return a -= b; }
+    friend dualN operator*(dualN a, const dualN &b) noexcept { return a *= b; }
+    friend dualN operator/(dualN a, const dualN &b) noexcept { return a /= b; }
+    friend dualN operator+(dualN a, const T &b) noexcept { return a += b; }
+    friend dualN operator-(dualN a, const T &b) noexcept { return a -= b; }
+    friend dualN operator*(dualN a, const T &b) noexcept { return a *= b; }
+    friend dualN operator/(dualN a, const T &b) noexcept { return a /= b; }
+    friend dualN operator+(const T &a, dualN b) noexcept { return b += a; }
+    friend dualN operator-(const T &a, const dualN &b) noexcept { dualN r = -b; return r += a; }
+    friend dualN operator*(const T &a, dualN b) noexcept { return b *= a; }
+    friend dualN operator/(const T &a, const dualN &b) noexcept { return dualN(a) /= b; }
+
+    friend bool operator==(const dualN &a, const dualN &b) noexcept { return a.value == b.value; }
+    friend bool operator!=(const dualN &a, const dualN &b) noexcept { return a.value != b.value; }
+    friend bool operator<(const dualN &a, const dualN &b) noexcept { return a.value < b.value; }
+    friend bool operator>(const dualN &a, const dualN &b) noexcept { return a.value > b.value; }
+    friend bool operator<=(const dualN &a, const dualN &b) noexcept { return a.value <= b.value; }
+    friend bool operator>=(const dualN &a, const dualN &b) noexcept { return a.value >= b.value; }
+
+    // f(value) with the derivatives scaled by f'(value)
+    dualN chain(const T f, const T derivative) const noexcept { dualN r; r.value = f; for (size_t k = 0; k < W; k++) r.d[k] = d[k] * derivative; return r; }
+};
+
+template <typename T>
+using dual = dualN<T, 1>;
+
+template <typename T, size_t W> dualN<T, W> sqrt(const dualN<T, W> &x) noexcept { const T s = sqrt(x.value); return x.chain(s, T(0.5) / s); }
+template <typename T, size_t W> dualN<T, W> exp(const dualN<T, W> &x) noexcept { const T e = exp(x.value); return x.chain(e, e); }
+template <typename T, size_t W> dualN<T, W> log(const dualN<T, W> &x) noexcept { return x.chain(log(x.value), T(1) / x.value); }
+template <typename T, size_t W> dualN<T, W> sin(const dualN<T, W> &x) noexcept { return x.chain(sin(x.value), cos(x.value)); }
+template <typename T, size_t W> dualN<T, W> cos(const dualN<T, W> &x) noexcept { return x.chain(cos(x.value), -sin(x.value)); }
+template <typename T, size_t W> dualN<T, W> tan(const dualN<T, W> &x) noexcept { const T t = tan(x.value); return x.chain(t, 1 + t * t); }
+template <typename T, size_t W> dualN<T, W> tanh(const dualN<T, W> &x) noexcept { const T t = tanh(x.value); return x.chain(t, 1 - t * t); }
+template <typename T, size_t W> dualN<T, W> atan(const dualN<T, W> &x) noexcept { return x.chain(atan(x.value), T(1) / (1 + x.value * x.value)); }
+template <typename T, size_t W> dualN<T, W> asin(const dualN<T, W> &x) noexcept { return x.chain(asin(x.value), T(1) / sqrt(1 - x.value * x.value)); }
+template <typename T, size_t W> dualN<T, W> acos(const dualN<T, W> &x) noexcept { return x.chain(acos(x.value), T(-1) / sqrt(1 - x.value * x.value)); }
+template <typename T, size_t W> dualN<T, W> fabs(const dualN<T, W> &x) noexcept { return x.value < 0 ? -x : x; }
+template <typename T, size_t W> dualN<T, W> abs(const dualN<T, W> &x) noexcept { return fabs(x); }
+template <typename T, size_t W> dualN<T, W> pow(const dualN<T, W> &x, const T p) noexcept { return x.chain(pow(x.value, p), p == T(0) ? T(0) : p * pow(x.value, p - 1)); }
+template <typename T, size_t W>
+dualN<T, W> atan2(const dualN<T, W> &y, const dualN<T, W> &x) noexcept
+{
+    const T inverse = T(1) / (x.value * x.value + y.value * y.value);
+    dualN<T, W> r(atan2(y.value, x.value));
+    for (size_t k = 0; k < W; k++)
+        r.d[k] = (x.value * y.d[k] - y.value * x.d[k]) * inverse;
+    return r;
+}
+
+// J(i, j) = d f_i / d x_j at x, with J.rows() the number of outputs of f(y, x), called with y of that size and x made of dualN<T, W>.
+// The columns are obtained W at a time : ceil(x.size() / W) evaluations of f, with their vectors taken from the internal::tmp pool.
+// If value is given it receives f(x).
+template <size_t W = 4, typename T, typename F>
+rowMajorMatrix<T> *jacobian(const F &f, const Vector<T> &x, rowMajorMatrix<T> &J, Vector<T> *value = nullptr)
+{
+    typedef dualN<T, W> D;
+    const size_t n = x.size(), m = J.rows();
+    J.resize(m, n, false, false);
+    if (value)
+        value->resize(m, false, false);
+    internal::tmp<Vector<D>> *xd = internal::tmp<Vector<D>>::get(n);
+    internal::tmp<Vector<D>> *yd = internal::tmp<Vector<D>>::get(m);
+    size_t first = 0;
+    do
+    {
+        const size_t width = n - first < W ? n - first : W;
+        for (size_t j = 0; j < n; j++)
+            (*xd)[j] = j >= first && j < first + width ? D::variable(x.begin()[j], j - first) : D(x.begin()[j]);
+        yd->fill(D());
+        f(*(Vector<D> *)yd, *(const Vector<D> *)xd);
+        for (size_t i = 0; i < m; i++)
+        {
+            const D &yi = yd->begin()[i];
+            for (size_t k = 0; k < width; k++)
+                J.begin()[i * n + first + k] = yi.d[k];
+            if (value && first == 0)
+                (*value)[i] = yi.value;
+        }
+        first += W;
+    } while (first < n);
+    xd->release();
+    yd->release();
+    return &J;
+}
+
+#endif
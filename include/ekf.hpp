@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef EKF_HPP
+#define EKF_HPP
+
+#include "symMatrix.hpp"
+#include "colMajorMatrix.hpp"
+#include <functional>
+
+// Extended Kalman filter of N states and M measurements.
+// Every workspace is allocated by the constructor : predict() and update() make no heap allocation and take nothing from the internal::tmp pool.
+// P is kept packed (symMatrix) and the gain K = P*H^T*S^-1 is obtained by solving S*K^T = H*P through the L*D*L^T factor of S, S^-1 is never formed.
+template <typename T, size_t N, size_t M>
+class ekf
+{
+public:
+    // fx = f(x, u), F = df/dx at (x, u)
+    typedef std::function<void(Vector<T> &fx, const Vector<T> &x, const Vector<T> &u)> transition;
+    typedef std::function<void(rowMajorMatrix<T> &F, const Vector<T> &x, const Vector<T> &u)> transitionJacobian;
+    // hx = h(x), H = dh/dx at x
+    typedef std::function<void(Vector<T> &hx, const Vector<T> &x)> measurement;
+    typedef std::function<void(rowMajorMatrix<T> &H, const Vector<T> &x)> measurementJacobian;
+
+protected:
+    transition f;
+    transitionJacobian df;
+    measurement h;
+    measurementJacobian dh;
+    rowMajorMatrix<T> F, H, FP, HP, W, K;
+    colMajorMatrix<T> Ft, Ht, Wt; // transposed views
+    ldl_matrix<T> S;
+    Vector<T> fx, hx, y, noControl;
+
+public:
+    Vector<T> x;    // state
+    symMatrix<T> P; // state covariance
+    symMatrix<T> Q; // process noise covariance
+    symMatrix<T> R; // measurement noise covariance
+
+    ekf(const transition &f, const transitionJacobian &df, const measurement &h, const measurementJacobian &dh);
+    ekf(const ekf &) = delete;
+    ekf &operator=(const ekf &) = delete;
+
+    // x = f(x, u), P = F*P*F^T + Q
+    ekf *predict(const Vector<T> &u);
+    ekf *predict() { return predict(noControl); }
+    // y = z - h(x), S = H*P*H^T + R, K = P*H^T*S^-1, x += K*y, P -= K*H*P
+    ekf *update(const Vector<T> &z);
+
+    // of the last update
+    const Vector<T> &innovation() const noexcept { return y; }
+    // S, with its factor in S.L and S.D
+    const ldl_matrix<T> &innovationCovariance() const noexcept { return S; }
+    const rowMajorMatrix<T> &gain() const noexcept { return K; }
+};
+
+#ifndef EKF_CPP
+#include "ekf.cpp"
+#endif // EKF_CPP
+
+#endif // EKF_HPP
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef EXPM_HPP
+#define EXPM_HPP
+
+#include "symMatrix.hpp"
+
+// Matrix exponential of n x n rowMajorMatrix, with workspaces allocated by the constructor : compute() makes no heap allocation.
+// pade : scaling and squaring with the diagonal [6/6] Pade approximant (Golub & Van Loan, algorithm 11.3.1), A is divided by 2^s so that
+// its infinity norm is at most 1/2, which bounds the relative error of the approximant below 4e-16, then the result is squared s times.
+// taylor : I + A + ... + A^order / order!, by Horner, without scaling. Cheaper (order products, no solve) and accurate when the norm of A is
+// small, e.g. A*dt for a short time step : the error is about norm^(order+1) / (order+1)!.
+template <typename T>
+class expm
+{
+public:
+    enum class method { pade, taylor };
+
+protected:
+    rowMajorMatrix<T> X, N, D, W;
+    // out = D^-1 * N by Gaussian elimination with partial pivoting, D and N destroyed
+    rowMajorMatrix<T> *solve(rowMajorMatrix<T> &out);
+    rowMajorMatrix<T> *identity(rowMajorMatrix<T> &m) const;
+
+public:
+    expm(const size_t order);
+    expm(const expm &) = delete;
+    expm &operator=(const expm &) = delete;
+
+    size_t order() const noexcept { return X.rows(); }
+    // out = exp(a), out must not be a
+    template <typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *compute(rowMajorMatrix<T> &out, const rowMajorMatrix<T> &a, const method m = method::pade, const size_t taylorOrder = 6);
+};
+
+// Discretization of the continuous model dx/dt = A*x + w, E[w(t)*w(s)^T] = Q*delta(t - s), over a step dt (Van Loan, 1978) :
+// exp([-A, Q; 0, A^T] * dt) = [., F^-1*Qd; 0, F^T] gives F = exp(A*dt) and Qd = integral of exp(A*t)*Q*exp(A^T*t) over [0, dt].
+template <typename T>
+class vanLoan
+{
+protected:
+    expm<T> exponential;
+    rowMajorMatrix<T> M, E;
+
+public:
+    vanLoan(const size_t order) : exponential(2 * order), M(2 * order, 2 * order), E(2 * order, 2 * order) {}
+    vanLoan(const vanLoan &) = delete;
+    vanLoan &operator=(const vanLoan &) = delete;
+
+    template <typename A = typename internal::accumulator<T>::type> vanLoan *discretize(rowMajorMatrix<T> &F, symMatrix<T> &Qd, const rowMajorMatrix<T> &a, const symMatrix<T> &q, const T dt, const typename expm<T>::method m = expm<T>::method::pade, const size_t taylorOrder = 6);
+};
+
+#ifndef EXPM_CPP
+#include "expm.cpp"
+#endif // EXPM_CPP
+
+#endif // EXPM_HPP
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FAST_MATH_HPP
+#define FAST_MATH_HPP
+
+#include <math.h>
+
+namespace internal
+{
+    inline uint32_t floatBits(const float value) noexcept { uint32_t bits; memcpy(&bits, &value, sizeof(bits)); return bits; }
+    inline float bitsFloat(const uint32_t bits) noexcept { float value; memcpy(&value, &bits, sizeof(value)); return value; }
+} // namespace internal
+
+// Single precision approximations of the elementwise functions of Vector (holdSqrt, holdExp, ..., normalize).
+// They are branch-light polynomials (the coefficients of Cephes' single precision functions), computed in float whatever T is.
+// Max error against the correctly rounded result, measured by test_5_scalar on samples of the ranges given :
+//   rsqrt 3 ulp and sqrt 1 ulp on the subnormals and [1e-3, 1e4], exp 1 ulp and tanh 1 ulp on [-80, 80], log 1 ulp on [1e-3, 1e4],
+//   atan2 4 ulp for finite x and y with |y / x| in [6e-4, 7e3] (NaN when both are infinite),
+//   sin and cos 1 ulp for |x| <= pi, absolute error below 1e-7 for |x| <= 8192 (but more ulp near their zeros),
+//   the libm function above (their reduction is not accurate there), NaN for an infinite or NaN x.
+// rsqrt(0) is inf and rsqrt(x < 0) NaN.
+// accuracy::full calls the libm function of T instead.
+namespace fastMath
+{
+    enum class accuracy : uint8_t { full, fast };
+
+    const float pi = 3.14159265358979f;
+
+    // magic constant estimate then 3 Newton iterations, x > 0 (a subnormal x is scaled by 2^24 first, like in log)
+    inline float rsqrt(float x) noexcept
+    {
+        if (!(x > 0.0f))
+            return x == 0.0f ? INFINITY : NAN;
+        float scale = 1.0f;
+        if (x < 1.17549435e-38f) // subnormal
+        {
+            x *= 16777216.0f;
+            scale = 4096.0f;
+        }
+        else if (x == INFINITY)
+            return 0.0f;
+        float y = ::internal::bitsFloat(0x5F375A86 - (::internal::floatBits(x) >> 1));
+        const float half = 0.5f * x;
+        y = y * (1.5f - half * y * y);
+        y = y * (1.5f - half * y * y);
+        return scale * y * (1.5f - half * y * y);
+    }
+
+    // x * rsqrt(x) with a last Newton step on the square root, 0 for x = 0
+    inline float sqrt(const float x) noexcept
+    {
+        if (x <= 0.0f)
+            return x == 0.0f ? 0.0f : NAN;
+        if (x == INFINITY)
+            return x;
+        if (x < 1.17549435e-38f) // subnormal, scaled by 2^24
+            return 2.44140625e-4f * sqrt(x * 16777216.0f);
+        const float s = x * rsqrt(x);
+        return s + 0.5f * (x - s * s) / s;
+    }
+
+    // x = k ln2 + r, |r| <= ln2/2, exp(r) by a degree 7 polynomial, 2^k by the exponent bits (in two steps at both ends of the range)
+    inline float exp(float x) noexcept
+    {
+        if (!(x == x))
+            return x;
+        if (x > 88.7228394f)
+            return INFINITY;
+        if (x < -103.9721f)
+            return 0.0f;
+        const float k = floorf(1.44269504089f * x + 0.5f);
+        x = x - k * 0.693359375f + k * 2.12194440e-4f;
+        const float z = x * x;
+        const float p = ((((((1.9875691500E-4f * x + 1.3981999507E-3f) * x + 8.3334519073E-3f) * x + 4.1665795894E-2f) * x + 1.6666665459E-1f) * x + 5.0000001201E-1f) * z + x) + 1.0f;
+        const int32_t e = (int32_t)k;
+        if (e > 127)
+            return p * 2.0f * ::internal::bitsFloat((uint32_t)(e - 1 + 127) << 23);
+        if (e < -125)
+            return p * ::internal::bitsFloat((uint32_t)(e + 64 + 127) << 23) * 5.42101086e-20f; // 2^-64
+        return p * ::internal::bitsFloat((uint32_t)(e + 127) << 23);
+    }
+
+    // x = m 2^e with sqrt(1/2) <= m < sqrt(2), log(m) by a degree 9 polynomial of m - 1
+    inline float log(float x) noexcept
+    {
+        if (!(x > 0.0f))
+            return x == 0.0f ? -INFINITY : NAN;
+        if (x == INFINITY)
+            return x;
+        int32_t e = 0;
+        if (x < 1.17549435e-38f) // subnormal
+        {
+            x *= 8388608.0f;
+            e = -23;
+        }
+        const uint32_t bits = ::internal::floatBits(x);
+        e += (int32_t)(bits >> 23) - 126;
+        x = ::internal::bitsFloat((bits & 0x007FFFFF) | 0x3F000000); // [0.5, 1)
+        if (x < 0.707106781186547524f)
+        {
+            e--;
+            x = x + x - 1.0f;
+        }
+        else
+            x = x - 1.0f;
+        const float z = x * x;
+        float y = ((((((((7.0376836292E-2f * x - 1.1514610310E-1f) * x + 1.1676998740E-1f) * x - 1.2420140846E-1f) * x + 1.4249322787E-1f) * x - 1.6668057665E-1f) * x + 2.0000714765E-1f) * x - 2.4999993993E-1f) * x + 3.3333331174E-1f) * x * z;
+        const float fe = (float)e;
+        y += -2.12194440e-4f * fe;
+        y += -0.5f * z;
+        return x + y + 0.693359375f * fe;
+    }
+
+    namespace internal
+    {
+        // |x| = j pi/4 + z, |z| <= pi/4, j even, j in [0, 8), for 0 <= ax <= 8192
+        inline float reduce(const float ax, uint32_t &j) noexcept
+        {
+            j = (uint32_t)(ax * 1.27323954473516f);
+            float y = (float)j;
+            if (j & 1)
+            {
+                j++;
+                y += 1.0f;
+            }
+            j &= 7;
+            return ((ax - y * 0.78515625f) - y * 2.4187564849853515625e-4f) - y * 3.77489497744594108e-8f;
+        }
+        inline float sinPoly(const float z, const float zz) noexcept { return ((-1.9515295891E-4f * zz + 8.3321608736E-3f) * zz - 1.6666654611E-1f) * zz * z + z; }
+        inline float cosPoly(const float zz) noexcept { return ((2.443315711809948E-005f * zz - 1.388731625493765E-003f) * zz + 4.166664568298827E-002f) * zz * zz - 0.5f * zz + 1.0f; }
+        // atan of x >= 0 : reduced to |x| <= tan(pi/8) by atan(x) = pi/2 + atan(-1/x) or pi/4 + atan((x-1)/(x+1))
+        inline float atanPositive(float x) noexcept
+        {
+            float y = 0.0f;
+            if (x > 2.414213562373095f)
+            {
+                y = 0.5f * pi;
+                x = -1.0f / x;
+            }
+            else if (x > 0.4142135623730950f)
+            {
+                y = 0.25f * pi;
+                x = (x - 1.0f) / (x + 1.0f);
+            }
+            const float z = x * x;
+            return y + ((((8.05374449538e-2f * z - 1.38776856032E-1f) * z + 1.99777106478E-1f) * z - 3.33329491539E-1f) * z * x + x);
+        }
+    } // namespace internal
+
+    inline float sin(const float x) noexcept
+    {
+        const float ax = x < 0.0f ? -x : x;
+        if (!(ax <= 8192.0f)) // NaN, infinite or too large for reduce()
+            return isfinite(x) ? ::sinf(x) : NAN;
+        uint32_t j;
+        const float z = internal::reduce(ax, j);
+        const float zz = z * z;
+        float sign = x < 0.0f ? -1.0f : 1.0f;
+        if (j > 3)
+        {
+            sign = -sign;
+            j -= 4;
+        }
+        return sign * ((j == 1 || j == 2) ? internal::cosPoly(zz) : internal::sinPoly(z, zz));
+    }
+
+    inline float cos(const float x) noexcept
+    {
+        const float ax = x < 0.0f ? -x : x;
+        if (!(ax <= 8192.0f)) // NaN, infinite or too large for reduce()
+            return isfinite(x) ? ::cosf(x) : NAN;
+        uint32_t j;
+        const float z = internal::reduce(ax, j);
+        const float zz = z * z;
+        float sign = 1.0f;
+        if (j > 3)
+        {
+            sign = -sign;
+            j -= 4;
+        }
+        if (j > 1)
+            sign = -sign;
+        return sign * ((j == 1 || j == 2) ? internal::sinPoly(z, zz) : internal::cosPoly(zz));
+    }
+
+    inline float atan2(const float y, const float x) noexcept
+    {
+        if (x == 0.0f)
+            return y == 0.0f ? (signbit(x) ? (signbit(y) ? -pi : pi) : y) : (y < 0.0f ? -0.5f * pi : 0.5f * pi);
+        const float ay = y < 0.0f ? -y : y;
+        const float ax = x < 0.0f ? -x : x;
+        float a = internal::atanPositive(ay / ax);
+        if (x < 0.0f)
+            a = pi - a;
+        return y < 0.0f || (y == 0.0f && signbit(y)) ? -a : a;
+    }
+
+    // odd polynomial below 0.625, 1 - 2 / (exp(2|x|) + 1) above
+    inline float tanh(const float x) noexcept
+    {
+        const float ax = x < 0.0f ? -x : x;
+        if (ax > 9.0f)
+            return x < 0.0f ? -1.0f : 1.0f;
+        if (ax >= 0.625f)
+        {
+            const float t = 1.0f - 2.0f / (exp(ax + ax) + 1.0f);
+            return x < 0.0f ? -t : t;
+        }
+        const float z = x * x;
+        return ((((-5.70498872745E-3f * z + 2.06390887954E-2f) * z - 5.37397155531E-2f) * z + 1.33314422036E-1f) * z - 3.33332819422E-1f) * z * x + x;
+    }
+} // namespace fastMath
+
+#endif
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FIXED_POINT_HPP
+#define FIXED_POINT_HPP
+
+#include "commun.hpp"
+
+// Q15 and Q31 fixed-point numbers in [-1, 1), usable as T in Vector and every matrix class.
+// Additions and subtractions saturate, the product of two numbers is exact (q15_product, q31_product) and is rounded when it is stored,
+// the kernels accumulate the products on 64 bits (q15_acc, q31_acc) through internal::accumulator.
+
+class q15;
+class q31;
+
+namespace internal
+{
+    inline int16_t saturate16(const int64_t value) noexcept { return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : (int16_t)value); }
+    inline int32_t saturate32(const int64_t value) noexcept { return value > INT32_MAX ? INT32_MAX : (value < INT32_MIN ? INT32_MIN : (int32_t)value); }
+    // round value * scale to the nearest integer, saturated to [min, max]
+    inline int64_t roundScaled(const double value, const double scale, const int64_t min, const int64_t max) noexcept
+    {
+        const double scaled = value * scale;
+        if (scaled >= (double)max)
+            return max;
+        if (scaled <= (double)min)
+            return min;
+        return (int64_t)(scaled >= 0 ? scaled + 0.5 : scaled - 0.5);
+    }
+} // namespace internal
+
+// exact product of two q15 (Q30 on 32 bits)
+class q15_product
+{
+public:
+    int32_t raw;
+    explicit q15_product(const int32_t raw) noexcept : raw(raw) {}
+    operator q15() const noexcept;
+    explicit operator float() const noexcept { return raw * (1.0f / 1073741824.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 1073741824.0); }
+};
+
+// sum of q15 products (Q30 on 64 bits), cannot overflow before 2^33 products
+class q15_acc
+{
+public:
+    int64_t raw = 0;
+    q15_acc() noexcept {}
+    q15_acc(const int value) noexcept : raw((int64_t)value * 1073741824) {}
+    q15_acc(const q15 value) noexcept;
+    q15_acc(const q15_product value) noexcept : raw(value.raw) {}
+    q15_acc &operator+=(const q15_acc other) noexcept { raw += other.raw; return *this; }
+    q15_acc &operator-=(const q15_acc other) noexcept { raw -= other.raw; return *this; }
+    q15_acc operator-() const noexcept { q15_acc r; r.raw = -raw; return r; }
+    operator q15() const noexcept;
+    explicit operator float() const noexcept { return raw * (1.0f / 1073741824.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 1073741824.0); }
+};
+
+class q15
+{
+public:
+    int16_t raw;
+    q15() = default;
+    q15(const int value) noexcept : raw(internal::saturate16((int64_t)value * 32768)) {}
+    q15(const float value) noexcept : raw((int16_t)internal::roundScaled(value, 32768.0, INT16_MIN, INT16_MAX)) {}
+    q15(const double value) noexcept : raw((int16_t)internal::roundScaled(value, 32768.0, INT16_MIN, INT16_MAX)) {}
+    static q15 fromRaw(const int16_t raw) noexcept { q15 r; r.raw = raw; return r; }
+    explicit operator float() const noexcept { return raw * (1.0f / 32768.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 32768.0); }
+
+    q15 operator-() const noexcept { return fromRaw(internal::saturate16(-(int32_t)raw)); }
+    q15 &operator+=(const q15 other) noexcept { raw = internal::saturate16((int32_t)raw + other.raw); return *this; }
+    q15 &operator-=(const q15 other) noexcept { raw = internal::saturate16((int32_t)raw - other.raw); return *this; }
+    q15 &operator*=(const q15 other) noexcept;
+    q15 &operator/=(const q15 other) noexcept;
+};
+
+inline q15_product::operator q15() const noexcept { return q15::fromRaw(internal::saturate16(((int64_t)raw + (1 << 14)) >> 15)); }
+inline q15_acc::q15_acc(const q15 value) noexcept : raw((int64_t)value.raw * 32768) {}
+inline q15_acc::operator q15() const noexcept { return q15::fromRaw(internal::saturate16((raw + (1 << 14)) >> 15)); }
+
+inline q15 operator+(const q15 a, const q15 b) noexcept { return q15::fromRaw(internal::saturate16((int32_t)a.raw + b.raw)); }
+inline q15 operator-(const q15 a, const q15 b) noexcept { return q15::fromRaw(internal::saturate16((int32_t)a.raw - b.raw)); }
+inline q15_product operator*(const q15 a, const q15 b) noexcept { return q15_product((int32_t)a.raw * b.raw); }
+// saturates to the extreme of the sign of a when the quotient is out of range (including b = 0)
+inline q15 operator/(const q15 a, const q15 b) noexcept
+{
+    if (b.raw == 0)
+        return q15::fromRaw(a.raw < 0 ? INT16_MIN : INT16_MAX);
+    return q15::fromRaw(internal::saturate16(((int32_t)a.raw * 32768) / b.raw));
+}
+inline q15_acc operator+(const q15_acc a, const q15_acc b) noexcept { q15_acc r; r.raw = a.raw + b.raw; return r; }
+inline q15_acc operator-(const q15_acc a, const q15_acc b) noexcept { q15_acc r; r.raw = a.raw - b.raw; return r; }
+inline q15 operator/(const q15_acc a, const q15 b) noexcept
+{
+    if (b.raw == 0)
+        return q15::fromRaw(a.raw < 0 ? INT16_MIN : INT16_MAX);
+    return q15::fromRaw(internal::saturate16(a.raw / b.raw));
+}
+inline q15 &q15::operator*=(const q15 other) noexcept { return *this = *this * other; }
+inline q15 &q15::operator/=(const q15 other) noexcept { return *this = *this / other; }
+
+inline bool operator==(const q15 a, const q15 b) noexcept { return a.raw == b.raw; }
+inline bool operator!=(const q15 a, const q15 b) noexcept { return a.raw != b.raw; }
+inline bool operator<(const q15 a, const q15 b) noexcept { return a.raw < b.raw; }
+inline bool operator>(const q15 a, const q15 b) noexcept { return a.raw > b.raw; }
+inline bool operator<=(const q15 a, const q15 b) noexcept { return a.raw <= b.raw; }
+inline bool operator>=(const q15 a, const q15 b) noexcept { return a.raw >= b.raw; }
+
+// exact product of two q31 (Q62 on 64 bits)
+class q31_product
+{
+public:
+    int64_t raw;
+    explicit q31_product(const int64_t raw) noexcept : raw(raw) {}
+    operator q31() const noexcept;
+    explicit operator float() const noexcept { return raw * (1.0f / 4611686018427387904.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 4611686018427387904.0); }
+};
+
+// sum of q31 products (Q48 on 64 bits, the 14 lowest bits of each product are rounded), cannot overflow before 2^14 products
+class q31_acc
+{
+public:
+    int64_t raw = 0;
+    q31_acc() noexcept {}
+    q31_acc(const int value) noexcept : raw((int64_t)value * 281474976710656) {}
+    q31_acc(const q31 value) noexcept;
+    q31_acc(const q31_product value) noexcept : raw((value.raw + (1 << 13)) >> 14) {}
+    q31_acc &operator+=(const q31_acc other) noexcept { raw += other.raw; return *this; }
+    q31_acc &operator-=(const q31_acc other) noexcept { raw -= other.raw; return *this; }
+    q31_acc operator-() const noexcept { q31_acc r; r.raw = -raw; return r; }
+    operator q31() const noexcept;
+    explicit operator float() const noexcept { return raw * (1.0f / 281474976710656.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 281474976710656.0); }
+};
+
+class q31
+{
+public:
+    int32_t raw;
+    q31() = default;
+    q31(const int value) noexcept : raw(internal::saturate32((int64_t)value * 2147483648)) {}
+    q31(const float value) noexcept : raw((int32_t)internal::roundScaled(value, 2147483648.0, INT32_MIN, INT32_MAX)) {}
+    q31(const double value) noexcept : raw((int32_t)internal::roundScaled(value, 2147483648.0, INT32_MIN, INT32_MAX)) {}
+    static q31 fromRaw(const int32_t raw) noexcept { q31 r; r.raw = raw; return r; }
+    explicit operator float() const noexcept { return raw * (1.0f / 2147483648.0f); }
+    explicit operator double() const noexcept { return raw * (1.0 / 2147483648.0); }
+
+    q31 operator-() const noexcept { return fromRaw(internal::saturate32(-(int64_t)raw)); }
+    q31 &operator+=(const q31 other) noexcept { raw = internal::saturate32((int64_t)raw + other.raw); return *this; }
+    q31 &operator-=(const q31 other) noexcept { raw = internal::saturate32((int64_t)raw - other.raw); return *this; }
+    q31 &operator*=(const q31 other) noexcept;
+    q31 &operator/=(const q31 other) noexcept;
+};
+
+inline q31_product::operator q31() const noexcept { return q31::fromRaw(internal::saturate32((raw >> 31) + ((raw >> 30) & 1))); }
+inline q31_acc::q31_acc(const q31 value) noexcept : raw((int64_t)value.raw * 131072) {}
+inline q31_acc::operator q31() const noexcept { return q31::fromRaw(internal::saturate32((raw + (1 << 16)) >> 17)); }
+
+inline q31 operator+(const q31 a, const q31 b) noexcept { return q31::fromRaw(internal::saturate32((int64_t)a.raw + b.raw)); }
+inline q31 operator-(const q31 a, const q31 b) noexcept { return q31::fromRaw(internal::saturate32((int64_t)a.raw - b.raw)); }
+inline q31_product operator*(const q31 a, const q31 b) noexcept { return q31_product((int64_t)a.raw * b.raw); }
+inline q31 operator/(const q31 a, const q31 b) noexcept
+{
+    if (b.raw == 0)
+        return q31::fromRaw(a.raw < 0 ? INT32_MIN : INT32_MAX);
+    return q31::fromRaw(internal::saturate32(((int64_t)a.raw * 2147483648) / b.raw));
+}
+inline q31_acc operator+(const q31_acc a, const q31_acc b) noexcept { q31_acc r; r.raw = a.raw + b.raw; return r; }
+inline q31_acc operator-(const q31_acc a, const q31_acc b) noexcept { q31_acc r; r.raw = a.raw - b.raw; return r; }
+// a.raw * 2^14 / b.raw without overflowing 64 bits
+inline q31 operator/(const q31_acc a, const q31 b) noexcept
+{
+    if (b.raw == 0)
+        return q31::fromRaw(a.raw < 0 ? INT32_MIN : INT32_MAX);
+    const int64_t quotient = a.raw / b.raw;
+    if (quotient >= (1 << 17) || quotient < -(1 << 17))
+        return q31::fromRaw(quotient < 0 ? INT32_MIN : INT32_MAX);
+    return q31::fromRaw(internal::saturate32(quotient * 16384 + ((a.raw % b.raw) * 16384) / b.raw));
+}
+inline q31 &q31::operator*=(const q31 other) noexcept { return *this = *this * other; }
+inline q31 &q31::operator/=(const q31 other) noexcept { return *this = *this / other; }
+
+inline bool operator==(const q31 a, const q31 b) noexcept { return a.raw == b.raw; }
+inline bool operator!=(const q31 a, const q31 b) noexcept { return a.raw != b.raw; }
+inline bool operator<(const q31 a, const q31 b) noexcept { return a.raw < b.raw; }
+inline bool operator>(const q31 a, const q31 b) noexcept { return a.raw > b.raw; }
+inline bool operator<=(const q31 a, const q31 b) noexcept { return a.raw <= b.raw; }
+inline bool operator>=(const q31 a, const q31 b) noexcept { return a.raw >= b.raw; }
+
+namespace internal
+{
+    template <> struct accumulator<q15> { typedef q15_acc type; };
+    template <> struct accumulator<q15_product> { typedef q15_acc type; };
+    template <> struct storage<q15_product> { typedef q15 type; };
+    template <> struct accumulator<q31> { typedef q31_acc type; };
+    template <> struct accumulator<q31_product> { typedef q31_acc type; };
+    template <> struct storage<q31_product> { typedef q31 type; };
+} // namespace internal
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALF_PRECISION_HPP
+#define HALF_PRECISION_HPP
+
+#include "commun.hpp"
+
+// 16-bit storage types (IEEE 754 binary16 and bfloat16), usable as T in Vector and the matrix classes to halve the memory and the bandwidth.
+// They only store values : any arithmetic converts them to float, so the kernels load them as float and accumulate in float
+// (internal::accumulator), or in double if asked, e.g. y.holdMul<half, half, double>(a, x). Storing a result rounds it to nearest even.
+
+class half
+{
+public:
+    uint16_t raw;
+    half() = default;
+    half(const float value) noexcept : raw(fromFloat(value)) {}
+    static half fromRaw(const uint16_t raw) noexcept { half h; h.raw = raw; return h; }
+    operator float() const noexcept { return toFloat(raw); }
+
+    half &operator+=(const float other) noexcept { return *this = (float)*this + other; }
+    half &operator-=(const float other) noexcept { return *this = (float)*this - other; }
+    half &operator*=(const float other) noexcept { return *this = (float)*this * other; }
+    half &operator/=(const float other) noexcept { return *this = (float)*this / other; }
+
+    static uint16_t fromFloat(const float value) noexcept
+    {
+        uint32_t x = internal::floatBits(value);
+        const uint16_t sign = (x >> 16) & 0x8000;
+        x &= 0x7FFFFFFF;
+        if (x >= 0x7F800000) // inf or NaN (kept quiet)
+            return sign | 0x7C00 | (x > 0x7F800000 ? 0x200 : 0);
+        if (x >= 0x477FF000) // rounds above 65504
+            return sign | 0x7C00;
+        if (x < 0x38800000) // subnormal, value = m * 2^-24
+        {
+            if (x < 0x33000000)
+                return sign;
+            const uint32_t mantissa = (x & 0x7FFFFF) | 0x800000;
+            const uint32_t shift = 126 - (x >> 23);
+            const uint32_t halfway = 1u << (shift - 1);
+            const uint32_t remainder = mantissa & ((1u << shift) - 1);
+            uint32_t m = mantissa >> shift;
+            if (remainder > halfway || (remainder == halfway && (m & 1)))
+                m++;
+            return sign | m;
+        }
+        // rebias the exponent (127 -> 15) and round the 13 dropped bits to nearest even
+        return sign | ((x + 0xC8000FFF + ((x >> 13) & 1)) >> 13);
+    }
+
+    static float toFloat(const uint16_t h) noexcept
+    {
+        const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+        uint32_t exponent = (h >> 10) & 0x1F;
+        uint32_t mantissa = h & 0x3FF;
+        if (exponent == 0x1F)
+            return internal::bitsFloat(sign | 0x7F800000 | (mantissa << 13));
+        if (exponent == 0)
+        {
+            if (mantissa == 0)
+                return internal::bitsFloat(sign);
+            exponent = 113;
+            while (!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            return internal::bitsFloat(sign | (exponent << 23) | ((mantissa & 0x3FF) << 13));
+        }
+        return internal::bitsFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+};
+
+// same range as float with an 8-bit mantissa, the conversions only round or shift the float bits
+class bfloat16
+{
+public:
+    uint16_t raw;
+    bfloat16() = default;
+    bfloat16(const float value) noexcept : raw(fromFloat(value)) {}
+    static bfloat16 fromRaw(const uint16_t raw) noexcept { bfloat16 b; b.raw = raw; return b; }
+    operator float() const noexcept { return internal::bitsFloat((uint32_t)raw << 16); }
+
+    bfloat16 &operator+=(const float other) noexcept { return *this = (float)*this + other; }
+    bfloat16 &operator-=(const float other) noexcept { return *this = (float)*this - other; }
+    bfloat16 &operator*=(const float other) noexcept { return *this = (float)*this * other; }
+    bfloat16 &operator/=(const float other) noexcept { return *this = (float)*this / other; }
+
+    static uint16_t fromFloat(const float value) noexcept
+    {
+        const uint32_t x = internal::floatBits(value);
+        if ((x & 0x7FFFFFFF) > 0x7F800000) // NaN (kept quiet)
+            return (x >> 16) | 0x40;
+        return (x + 0x7FFF + ((x >> 16) & 1)) >> 16;
+    }
+};
+
+namespace internal
+{
+    template <> struct accumulator<half> { typedef float type; };
+    template <> struct accumulator<bfloat16> { typedef float type; };
+} // namespace internal
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef INNOVATION_GATE_HPP
+#define INNOVATION_GATE_HPP
+
+#include "ldl_Matrix.hpp"
+#include "colMajorMatrix.hpp"
+#include <math.h>
+
+// Validation gate of the candidate measurements of a track : S = L*D*L^T is factored once per predicted measurement (or copied from a
+// filter that already did, e.g. ekf::innovationCovariance()), then each batch of K innovations, the columns of a colMajorMatrix, is tested
+// with one forward substitution for all of them : Y = L^-1 * innovations, computed row by row with the K candidates in the inner loop, and
+// d2_k = sum of Y(i, k)^2 / D(i), the squared Mahalanobis distance. S^-1 is never formed : m^2 * K multiply-adds for the batch instead of
+// the m^3 of an inverse per candidate.
+// setCovariance() or setFactor() must be called before the first batch. A candidate is inside the gate when d2 <= threshold, by default the chi-square quantile of order degrees of freedom for the probability.
+// Every workspace is allocated by the constructor for capacity candidates, a larger batch grows it once.
+template <typename T>
+class innovationGate
+{
+protected:
+    ldl_matrix<T> S;
+    rowMajorMatrix<T> Y;
+    T _logDeterminant = 0;
+    T _threshold;
+
+    // lower regularized incomplete gamma function P(a, x)
+    static double gammaP(const double a, const double x);
+    // d2 of the candidates, Y = L^-1 * innovations
+    void solve(Vector<T> &d2, const colMajorMatrix<T> &innovations);
+
+public:
+    innovationGate(const size_t order, const size_t capacity = 1, const T probability = T(0.99));
+    innovationGate(const innovationGate &) = delete;
+    innovationGate &operator=(const innovationGate &) = delete;
+
+    size_t order() const noexcept { return S.rows(); }
+    // x such that P(chi2 of dof degrees of freedom <= x) = probability
+    static T chiSquareQuantile(const size_t dof, const T probability);
+
+    // factors S, which must be positive definite
+    innovationGate *setCovariance(const symMatrix<T> &s);
+    // takes the factor of S as it is, in s.L and s.D
+    innovationGate *setFactor(const ldl_matrix<T> &s);
+    innovationGate *setThreshold(const T threshold) noexcept { _threshold = threshold; return this; }
+    innovationGate *setProbability(const T probability) { _threshold = chiSquareQuantile(order(), probability); return this; }
+    T threshold() const noexcept { return _threshold; }
+    // log(det(S))
+    T logDeterminant() const noexcept { return _logDeterminant; }
+
+    // d2[k] = innovations(:, k)^T * S^-1 * innovations(:, k)
+    Vector<T> *mahalanobis(Vector<T> &d2, const colMajorMatrix<T> &innovations);
+    // out[k] = log N(innovations(:, k); 0, S) = -(d2[k] + log(det(S)) + order * log(2 * pi)) / 2
+    Vector<T> *logLikelihood(Vector<T> &out, const colMajorMatrix<T> &innovations);
+    // d2 as mahalanobis(), accepted[0 .. returned count) the indices of the candidates inside the gate, in increasing order
+    size_t gate(Vector<size_t> &accepted, Vector<T> &d2, const colMajorMatrix<T> &innovations);
+    bool inside(const T d2) const noexcept { return d2 <= _threshold; }
+};
+
+#ifndef INNOVATION_GATE_CPP
+#include "innovationGate.cpp"
+#endif // INNOVATION_GATE_CPP
+
+#endif // INNOVATION_GATE_HPP
@@ -39,7 +39,7 @@ class ldl_matrix : public symMatrix<T>
         ldl_matrix() : symMatrix<T>(){}
         ldl_matrix(const size_t order) : symMatrix<T>(){this->resize(order);}
         ldl_matrix<T> *resize(const size_t order, const bool deallocIfPossible = false, const bool saveData = true) {symMatrix<T>::resize(order,order, deallocIfPossible, saveData); L.resize(order,order); D.resize(order,order); referT(); return this;}
-        ldl_matrix<T> *decompose();
+        template <typename A = typename internal::accumulator<T>::type> ldl_matrix<T> *decompose();
 };
 
 
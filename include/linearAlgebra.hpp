@@ -30,5 +30,23 @@
 #include <ul_triangMatrix.hpp>
 #include <uu_triangMatrix.hpp>
 #include <ldl_Matrix.hpp>
+#include <csrMatrix.hpp>
+#include <cscMatrix.hpp>
+#include <bandMatrix.hpp>
+#include <blockDiagMatrix.hpp>
+#include <ringBuffer.hpp>
+#include <ekf.hpp>
+#include <ud_filter.hpp>
+#include <ukf.hpp>
+#include <particleFilter.hpp>
+#include <rls.hpp>
+#include <expm.hpp>
+#include <symEigen.hpp>
+#include <svd.hpp>
+#include <innovationGate.hpp>
+#include <fixedPoint.hpp>
+#include <halfPrecision.hpp>
+#include <dual.hpp>
+#include <parallel.hpp>
 
 #endif
\ No newline at end of file
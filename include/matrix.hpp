@@ -83,7 +83,7 @@ namespace operators
 {
     template<typename T, typename U, typename V=decltype(T() + U())> internal::tmp<rowMajorMatrix<T>> &&operator+(const Matrix<T> &a, const Matrix<T> &b){return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U, typename V=decltype(T() - U())> internal::tmp<rowMajorMatrix<T>> &&operator-(const Matrix<T> &a, const Matrix<T> &b){return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V=decltype(T() * U())> internal::tmp<rowMajorMatrix<T>> &&operator*(const Matrix<T> &a, const Matrix<T> &b){return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<T>> &&operator*(const Matrix<T> &a, const Matrix<T> &b){return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
 
 };
 
@@ -46,6 +46,21 @@ class uu_triangMatrix;
 template <typename T = float>
 class ldl_matrix;
 
+template <typename T = float>
+class csrMatrix;
+
+template <typename T = float>
+class cscMatrix;
+
+template <typename T = float>
+class bandMatrix;
+
+template <typename T = float>
+class blockDiagMatrix;
+
+template <typename T = float>
+class ringBuffer;
+
 template <typename T = float>
 class MatrixBase : public Vector<T>
 {
@@ -69,6 +84,14 @@ class MatrixBase : public Vector<T>
     friend class uu_triangMatrix;
     template <typename U>
     friend class ldl_matrix;
+    template <typename U>
+    friend class csrMatrix;
+    template <typename U>
+    friend class cscMatrix;
+    template <typename U>
+    friend class bandMatrix;
+    template <typename U>
+    friend class blockDiagMatrix;
 
 protected:
     size_t _rows = 0;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include "threadPool.hpp"
+#include <vector>
+
+// number of threads used by parallel_for, taskGroup and the kernels, including the calling one (1 by default).
+// Must not be called while they run.
+inline void setThreadCount(const size_t threads) { internal::threadPool::global().resize(threads); }
+inline size_t threadCount() noexcept { return internal::threadPool::global().size(); }
+
+// calls f(rangeBegin, rangeEnd) over contiguous ranges splitting [begin, end), one per thread, and returns when they are all done.
+// The bounds of the ranges are multiples of grain (except end), e.g. internal::threadPool::rowAlign(sizeof(T)) so that two ranges never write the same cache line of a T array.
+template <typename F>
+void parallel_for(const size_t begin, const size_t end, const F &f, const size_t grain = 1)
+{
+    if (end <= begin)
+        return;
+    internal::threadPool &pool = internal::threadPool::global();
+    pool.forBlocks(end - begin, grain ? grain : 1, pool.threshold, [&](const size_t rangeBegin, const size_t rangeEnd) { f(begin + rangeBegin, begin + rangeEnd); });
+}
+
+// independent tasks run over the threads : run() queues them, wait() runs the queued tasks and returns when they are all done.
+class taskGroup
+{
+private:
+    std::vector<std::function<void()>> tasks;
+
+public:
+    taskGroup *run(const std::function<void()> &task) { tasks.push_back(task); return this; }
+    taskGroup *wait()
+    {
+        internal::threadPool::global().run(tasks.size(), [this](const size_t i) { tasks[i](); });
+        tasks.clear();
+        return this;
+    }
+    size_t size() const noexcept { return tasks.size(); }
+};
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PARTICLE_FILTER_HPP
+#define PARTICLE_FILTER_HPP
+
+#include "colMajorMatrix.hpp"
+#include "parallel.hpp"
+#include <functional>
+
+// Particle filter of `count` particles of `dims` states.
+// The states are stored as structure of arrays : column j of the colMajorMatrix holds the j-th state of every particle, contiguous.
+// The weights are kept as logarithms and normalized with the log-sum-exp trick, so that very unlikely measurements never underflow them.
+// Resampling is systematic or stratified, by a single merge of the sorted targets with the prefix sums of the weights, O(count).
+// The states are double buffered : resampling gathers into the second buffer and swaps them.
+// Every workspace is allocated by the constructor : the steps make no heap allocation.
+template <typename T>
+class particleFilter
+{
+public:
+    // moves the particles [begin, end) of states one step forward, with the control u.
+    // Called concurrently on disjoint ranges when parallel : it must then be thread safe (e.g. one random generator per range or per particle).
+    typedef std::function<void(colMajorMatrix<T> &states, const size_t begin, const size_t end, const Vector<T> &u)> propagation;
+    // logLikelihood[i] = log p(z | particle i) for the particles [begin, end), same threading as propagation
+    typedef std::function<void(Vector<T> &logLikelihood, const colMajorMatrix<T> &states, const size_t begin, const size_t end, const Vector<T> &z)> likelihood;
+
+protected:
+    propagation propagate;
+    likelihood weigh;
+    colMajorMatrix<T> buffers[2];
+    size_t current = 0;
+    Vector<T> _logWeights, _weights, cumulative, logLikelihood, noControl;
+    Vector<size_t> indices;
+    // gathers the particles indices into the other buffer and swaps them
+    particleFilter *gather();
+
+public:
+    particleFilter(const size_t count, const size_t dims, const propagation &propagate, const likelihood &weigh);
+    particleFilter(const particleFilter &) = delete;
+    particleFilter &operator=(const particleFilter &) = delete;
+
+    size_t count() const noexcept { return _weights.size(); }
+    size_t dims() const noexcept { return buffers[current].cols(); }
+    colMajorMatrix<T> &states() noexcept { return buffers[current]; }
+    const colMajorMatrix<T> &states() const noexcept { return buffers[current]; }
+    // normalized, summing to 1
+    const Vector<T> &weights() const noexcept { return _weights; }
+    // normalized, log-sum-exp of them is 0
+    const Vector<T> &logWeights() const noexcept { return _logWeights; }
+
+    // propagation of every particle, split over the threads if parallel
+    particleFilter *predict(const Vector<T> &u, const bool parallel = false);
+    particleFilter *predict(const bool parallel = false) { return predict(noControl, parallel); }
+    // log weights += log likelihood of z, then normalization
+    particleFilter *update(const Vector<T> &z, const bool parallel = false);
+    // weights = exp(log weights - max), divided by their sum, and log weights shifted to match.
+    // Throws if every log weight is -inf or one is +inf or NaN (the weights are then left unspecified)
+    particleFilter *normalize(const fastMath::accuracy accuracy = fastMath::accuracy::full);
+
+    // 1 / sum of the squared weights, between 1 and count
+    T effectiveSampleSize() const;
+    // weighted mean of the states
+    template <typename A = typename internal::accumulator<T>::type> Vector<T> *mean(Vector<T> &out) const;
+
+    // one uniform u in [0, 1) shared by the count targets (u + i) / count
+    particleFilter *resampleSystematic(const T u);
+    // one uniform per target (i + uniform()) / count, uniform() in [0, 1)
+    template <typename G> particleFilter *resampleStratified(G &uniform);
+};
+
+#ifndef PARTICLE_FILTER_CPP
+#include "particleFilter.cpp"
+#endif // PARTICLE_FILTER_CPP
+
+#endif // PARTICLE_FILTER_HPP
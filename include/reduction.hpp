@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REDUCTION_HPP
+#define REDUCTION_HPP
+
+#include <math.h>
+
+// reductions of contiguous values, used by the Vector and matrix reductions (sum, norms, variance, trace, row and column sums).
+// They keep 4 independent partial sums : consecutive additions do not wait for each other, so they fill the FPU pipeline
+// (and the vector lanes, when the compiler can reassociate) instead of being bound by the latency of one addition.
+namespace internal
+{
+namespace reduction
+{
+    template <typename T> inline T abs(const T &x) { return x < T() ? T(-x) : x; }
+
+    template <typename A, typename T>
+    A sum(const T *x, const size_t n)
+    {
+        A s0 = A(), s1 = A(), s2 = A(), s3 = A();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            s0 += x[i];
+            s1 += x[i + 1];
+            s2 += x[i + 2];
+            s3 += x[i + 3];
+        }
+        for (; i < n; i++)
+            s0 += x[i];
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    template <typename A, typename T>
+    A sumAbs(const T *x, const size_t n)
+    {
+        A s0 = A(), s1 = A(), s2 = A(), s3 = A();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            s0 += abs(x[i]);
+            s1 += abs(x[i + 1]);
+            s2 += abs(x[i + 2]);
+            s3 += abs(x[i + 3]);
+        }
+        for (; i < n; i++)
+            s0 += abs(x[i]);
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    // sum of (x[i] - center)^2
+    template <typename A, typename T>
+    A sumSquares(const T *x, const size_t n, const A center = A())
+    {
+        A s0 = A(), s1 = A(), s2 = A(), s3 = A();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const A d0 = A(x[i]) - center, d1 = A(x[i + 1]) - center, d2 = A(x[i + 2]) - center, d3 = A(x[i + 3]) - center;
+            s0 += d0 * d0;
+            s1 += d1 * d1;
+            s2 += d2 * d2;
+            s3 += d3 * d3;
+        }
+        for (; i < n; i++)
+        {
+            const A d = A(x[i]) - center;
+            s0 += d * d;
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    template <typename T>
+    T maxAbs(const T *x, const size_t n)
+    {
+        T m0 = T(), m1 = T();
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+            const T a0 = abs(x[i]), a1 = abs(x[i + 1]);
+            if (m0 < a0)
+                m0 = a0;
+            if (m1 < a1)
+                m1 = a1;
+        }
+        if (i < n && m0 < abs(x[i]))
+            m0 = abs(x[i]);
+        return m0 < m1 ? m1 : m0;
+    }
+
+    // index of the first smallest (Less = less) or greatest (Less = greater) value, n > 0
+    template <typename T, typename Less>
+    size_t argBest(const T *x, const size_t n, const Less &less)
+    {
+        size_t best = 0;
+        for (size_t i = 1; i < n; i++)
+            if (less(x[i], x[best]))
+                best = i;
+        return best;
+    }
+
+    // y[i] = x[0] + ... + x[i], accumulated in A, y can be x
+    template <typename A, typename T, typename U>
+    void prefixSum(T *y, const U *x, const size_t n)
+    {
+        A s = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            s += x[i];
+            y[i] = s;
+        }
+    }
+
+    // y[j] = sum of x[i * stride + j] over the rows i, for j < n, accumulated in A : the columns are taken by strips of 16,
+    // each strip read row after row along the storage into 16 accumulators, so that no workspace is needed
+    template <typename A, typename T, typename U>
+    void sumStrided(T *y, const U *x, const size_t rows, const size_t n, const size_t stride)
+    {
+        const size_t strip = 16;
+        for (size_t begin = 0; begin < n; begin += strip)
+        {
+            const size_t width = n - begin < strip ? n - begin : strip;
+            A s[strip];
+            for (size_t j = 0; j < width; j++)
+                s[j] = A();
+            for (size_t i = 0; i < rows; i++)
+            {
+                const U *xi = x + i * stride + begin;
+                for (size_t j = 0; j < width; j++)
+                    s[j] += xi[j];
+            }
+            for (size_t j = 0; j < width; j++)
+                y[begin + j] = s[j];
+        }
+    }
+} // namespace reduction
+} // namespace internal
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include "vector.hpp"
+#include <atomic>
+
+// Circular buffer of the last values of a stream (sensor window), stored in a Vector allocated once.
+// push() and pop() are lock-free for one producer and one consumer (e.g. an ISR and a task), the other methods are for the consumer.
+// The window (oldest value first) is seen without copy as one or two Vector views on the storage, or as one view after linearize().
+template <typename T>
+class ringBuffer
+{
+protected:
+    Vector<T> _data;
+    // positions in [0, 2 * capacity) so that a full buffer (head - tail = capacity) differs from an empty one
+    std::atomic<size_t> _head; // next position written, only written by the producer
+    std::atomic<size_t> _tail; // oldest position, only written by the consumer
+
+    size_t next(const size_t position) const noexcept { return position + 1 == 2 * _data.size() ? 0 : position + 1; }
+    size_t index(const size_t position) const noexcept { return position < _data.size() ? position : position - _data.size(); }
+    size_t distance(const size_t from, const size_t to) const noexcept { return to >= from ? to - from : to + 2 * _data.size() - from; }
+    // makes v a view on [data, data + n), freeing what it owned
+    static void view(Vector<T> &v, T *data, const size_t n) noexcept;
+
+public:
+    ringBuffer(const size_t capacity) : _data(capacity), _head(0), _tail(0) {}
+    ringBuffer(const ringBuffer &) = delete;
+    ringBuffer &operator=(const ringBuffer &) = delete;
+
+    size_t capacity() const noexcept { return _data.size(); }
+    size_t size() const noexcept { return distance(_tail.load(std::memory_order_acquire), _head.load(std::memory_order_acquire)); }
+    bool empty() const noexcept { return size() == 0; }
+    bool full() const noexcept { return size() == capacity(); }
+
+    // producer : false if full
+    bool push(const T &value) noexcept;
+    // consumer : false if empty
+    bool pop(T &value) noexcept;
+    // consumer : drops the n oldest values (all of them if fewer)
+    ringBuffer *discard(const size_t n) noexcept;
+    // producer and consumer in the same thread : pushes, dropping the oldest value if full (sliding window)
+    ringBuffer *slide(const T &value) noexcept;
+    ringBuffer *clear() noexcept { _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release); return this; }
+
+    // i-th oldest value
+    const T &operator[](const size_t i) const noexcept;
+    const T &back() const noexcept { return (*this)[size() - 1]; }
+
+    // the window as first followed by second, second being empty when the window does not wrap around the storage
+    const ringBuffer *views(Vector<T> &first, Vector<T> &second) const noexcept;
+    // rotates the storage in place so that the window is contiguous and refers view to it.
+    // Moves the values : not concurrent with push() and pop()
+    ringBuffer *linearize(Vector<T> &view) noexcept;
+    // copies the window, oldest value first
+    Vector<T> *copyTo(Vector<T> &holder) const;
+};
+
+#ifndef RING_BUFFER_CPP
+#include "ringBuffer.cpp"
+#endif // RING_BUFFER_CPP
+
+#endif // RING_BUFFER_HPP
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RLS_HPP
+#define RLS_HPP
+
+#include "symMatrix.hpp"
+#include "colMajorMatrix.hpp"
+
+// Recursive least squares estimate of the N parameters theta of y = phi^T * theta + noise, with exponential forgetting.
+// P is kept packed (symMatrix) and a sample costs O(N^2) : g = P*phi, then P = (P - g*g^T / (lambda + phi^T*g)) / lambda in a single pass.
+// Blocks of B samples can be processed at once (log replays) : their B x B innovation covariance is factored by an ldl_matrix, with the same result as B single updates.
+// Every workspace is allocated by the constructor : the updates make no heap allocation and take nothing from the internal::tmp pool.
+template <typename T, size_t N, size_t B = 1>
+class rls
+{
+protected:
+    Vector<T> g, k;
+    T e = 0; // a priori error of the last sample, before its whole block for a block update
+    T initial;
+    rowMajorMatrix<T> PhiP, W, K; // block workspaces : Phi*P, W = S^-1*Phi*P = K^T
+    colMajorMatrix<T> Wt;
+    ldl_matrix<T> S;
+    Vector<T> errors;
+    // reset when the trace of P exceeds maxTrace (wind-up under forgetting without excitation)
+    rls *checkTrace();
+
+public:
+    Vector<T> theta; // parameters
+    symMatrix<T> P;  // covariance, up to the noise variance
+    T lambda;        // forgetting factor, in (0, 1]
+    T maxTrace = 0;  // 0 : never reset
+
+    rls(const T lambda = 1, const T initialCovariance = 1000);
+    rls(const rls &) = delete;
+    rls &operator=(const rls &) = delete;
+
+    // P = initialCovariance * identity, theta kept
+    rls *reset(const T initialCovariance);
+    rls *reset() { return reset(initial); }
+
+    // one sample
+    template <typename A = typename internal::accumulator<T>::type> rls *update(const Vector<T> &phi, const T y);
+    // B samples, the rows of Phi, the last one being the most recent
+    rls *update(const rowMajorMatrix<T> &Phi, const Vector<T> &y);
+
+    template <typename A = typename internal::accumulator<T>::type> T predict(const Vector<T> &phi) const;
+    T error() const noexcept { return e; }
+    // of the last single update
+    const Vector<T> &gain() const noexcept { return k; }
+};
+
+#ifndef RLS_CPP
+#include "rls.cpp"
+#endif // RLS_CPP
+
+#endif // RLS_HPP
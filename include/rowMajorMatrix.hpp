@@ -62,21 +62,21 @@ class rowMajorMatrix : public MatrixBase<T>
         rowMajorMatrix *hold(const rowMajorMatrix &other, const bool checkSize = true) { return (rowMajorMatrix *)(checkSize? MatrixBase<T>::resizeLike(other):this)->Vector<T>::hold(other, false); };
         template<typename U> rowMajorMatrix<T> *hold(const rowMajorMatrix<U> &other, const bool checkSize = true){ return (rowMajorMatrix *)(checkSize? MatrixBase<T>::resizeLike(other):this)->Vector<T>::hold(other, false); };
         template<typename U, typename V> rowMajorMatrix<T> *holdAdd(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true){ return (rowMajorMatrix<T> *)(checkSize? MatrixBase<T>::checkSize_add(a,b):this)->Vector<T>::holdAdd(a, b, false); };
-        template<typename U, typename V> rowMajorMatrix<T> *holdSub(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true){ return (rowMajorMatrix<T> *)(checkSize? MatrixBase<T>::checkSize_sub(a,b):this)->Vector<T>::holdSub(a, b, false); };
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V> rowMajorMatrix<T> *holdSub(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true){ return (rowMajorMatrix<T> *)(checkSize? MatrixBase<T>::checkSize_add(a,b):this)->Vector<T>::holdSub(a, b, false); };
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         
         // colMajorMatrix and colMajorMatrix
         template<typename U> rowMajorMatrix<T> *hold(const colMajorMatrix<U> &other, const bool checkSize = true);
         template<typename U, typename V> rowMajorMatrix<T> *holdAdd(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> rowMajorMatrix<T> *holdSub(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
 
         // rowMajorMatrix and colMajorMatrix
         template<typename U, typename V> rowMajorMatrix<T> *holdAdd(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> rowMajorMatrix<T> *holdSub(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> rowMajorMatrix<T> *holdSub(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
 
         // rowMajorMatrix and diagMatrix
         template<typename U> rowMajorMatrix<T> *hold(const diagMatrix<U> &other, const bool checkSize = true);
@@ -88,9 +88,26 @@ class rowMajorMatrix : public MatrixBase<T>
         template<typename U, typename V> rowMajorMatrix<T> *holdSub(const diagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         template<typename U, typename V> rowMajorMatrix<T> *holdMul(const diagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         // rowMajorMatrix and symMatrix
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
         // colMajorMatrix and symMatrix
-        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const colMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
+        // csrMatrix and rowMajorMatrix
+        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const csrMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        // rowMajorMatrix and cscMatrix
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const cscMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        // bandMatrix and rowMajorMatrix
+        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const bandMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const bandMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        // blockDiagMatrix and rowMajorMatrix
+        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const blockDiagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V> rowMajorMatrix<T> *holdMul(const rowMajorMatrix<U> &a, const blockDiagMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        // solve L*D*L^T * X = B for all the columns of B at once, with the factor given by ldl_matrix::decompose(), b can be this
+        template<typename U, typename V> rowMajorMatrix<T> *holdSolveLDL(const ldl_matrix<U> &factor, const rowMajorMatrix<V> &b, const bool checkSize = true);
+        // sum over the columns k of a and b of weights[k] * (a_k - meanA) * (b_k - meanB)^T
+        template<typename U, typename V, typename W> rowMajorMatrix<T> *holdWeightedCross(const colMajorMatrix<U> &a, const Vector<V> &meanA, const colMajorMatrix<U> &b, const Vector<V> &meanB, const Vector<W> &weights, const bool checkSize = true);
+        // csrMatrix and cscMatrix (densify)
+        template<typename U> rowMajorMatrix<T> *hold(const csrMatrix<U> &other, const bool checkSize = true);
+        template<typename U> rowMajorMatrix<T> *hold(const cscMatrix<U> &other, const bool checkSize = true);
         ////////////////////////// operators //////////////////////////
         // dataType
         // template<typename U> rowMajorMatrix<T> *operator=(const U &data) { return (rowMajorMatrix<T> *)this->Vector<T>::operator=(data); };
@@ -153,44 +170,44 @@ namespace operators
     // rowMajorMatrix and rowMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(const rowMajorMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(const rowMajorMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
     
     // tmp rowMajorMatrix and rowMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(internal::tmp<rowMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<U>> &&operator+(const rowMajorMatrix<T> &a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<U>>*)b.holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(internal::tmp<rowMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdSub(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<U>> &&operator-(const rowMajorMatrix<T> &a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<U>>*)b.holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>> *)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>> *)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
     // tmp rowMajorMatrix and tmp rowMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdAdd(a, *b.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdSub(a, *b.release(), operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<rowMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
 
     // rowMajorMatrix and colMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(const rowMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(const colMajorMatrix<U> &a, const rowMajorMatrix<T> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(b.rows(), b.cols())->holdAdd(b, a, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(const rowMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(const colMajorMatrix<U> &a, const rowMajorMatrix<T> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(b.rows(), b.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<U> &a, const rowMajorMatrix<T> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(b.rows(), a.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<U> &a, const rowMajorMatrix<T> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(b.rows(), a.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
     // tmp rowMajorMatrix and colMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(internal::tmp<rowMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdAdd(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(const colMajorMatrix<U> &a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)b.holdAdd(b, a, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(internal::tmp<rowMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdSub(a, b, operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(const colMajorMatrix<U> &a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)b.holdSub(a, b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<U> &a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(b.rows(), a.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const colMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<U> &a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(b.rows(), a.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
     // tmp colMajorMatrix and rowMajorMatrix
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<U> &a, internal::tmp<colMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<T>> &&a, const rowMajorMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<U> &a, internal::tmp<colMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
     // tmp rowMajorMatrix and tmp colMajorMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdAdd(a, *b.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(internal::tmp<colMajorMatrix<U>> &&a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)b.holdAdd(b, *a.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)a.holdSub(a, *b.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(internal::tmp<colMajorMatrix<U>> &&a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)b.holdSub(*a.release(), b, operators::MatrixCheckSize)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<U>> &&a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, internal::tmp<colMajorMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<colMajorMatrix<U>> &&a, internal::tmp<rowMajorMatrix<T>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
 
     // rowMajorMatrix and diagMatrix
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator+(const rowMajorMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
@@ -224,9 +241,10 @@ namespace operators
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator-(const rowMajorMatrix<T> &a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdSub(a, *b.release(), operators::MatrixCheckSize)); };
     template<typename T, typename U> internal::tmp<rowMajorMatrix<T>> &&operator*(const rowMajorMatrix<T> &a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<rowMajorMatrix<T>>*)internal::tmp<rowMajorMatrix<T>>::get(a.rows(), a.cols())->holdMul(a, *b.release(), operators::MatrixCheckSize)); };
     // rowMajorMatrix and symMatrix
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const rowMajorMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(internal::tmp<rowMajorMatrix<T>> &&a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize)); };
     //colMajorMatrix and symMatrix
-    template<typename T, typename U, typename V = decltype(T() * U())> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template<typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<rowMajorMatrix<V>> &&operator*(const colMajorMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<rowMajorMatrix<V>>*)internal::tmp<rowMajorMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
 }
 
 #ifndef ROW_MAJOR_MATRIX_CPP
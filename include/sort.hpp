@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include <type_traits>
+
+// in-place sorting and selection of contiguous values, used by Vector::sort, radixSort, argsort, nthElement and partialSort
+namespace internal
+{
+namespace sorting
+{
+    // ranges shorter than this are finished by an insertion sort
+    const size_t insertionThreshold = 16;
+
+    template <typename T> struct less { bool operator()(const T &a, const T &b) const { return a < b; } };
+    template <typename T> struct greater { bool operator()(const T &a, const T &b) const { return b < a; } };
+
+    inline size_t depthLimit(size_t n)
+    {
+        size_t depth = 0;
+        for (; n > 1; n >>= 1)
+            depth += 2;
+        return depth;
+    }
+
+    template <typename T, typename Less>
+    void insertion(T *first, T *last, const Less &less)
+    {
+        if (last - first < 2)
+            return;
+        for (T *i = first + 1; i < last; i++)
+        {
+            T value = move(*i);
+            T *j = i;
+            for (; j > first && less(value, *(j - 1)); j--)
+                *j = move(*(j - 1));
+            *j = move(value);
+        }
+    }
+
+    template <typename T, typename Less>
+    void siftDown(T *first, size_t i, const size_t n, const Less &less)
+    {
+        T value = move(first[i]);
+        for (size_t child; (child = 2 * i + 1) < n; i = child)
+        {
+            if (child + 1 < n && less(first[child], first[child + 1]))
+                child++;
+            if (!less(value, first[child]))
+                break;
+            first[i] = move(first[child]);
+        }
+        first[i] = move(value);
+    }
+
+    template <typename T, typename Less>
+    void heapsort(T *first, T *last, const Less &less)
+    {
+        const size_t n = last - first;
+        for (size_t i = n / 2; i-- > 0;)
+            siftDown(first, i, n, less);
+        for (size_t end = n; end > 1;)
+        {
+            end--;
+            swap(first[0], first[end]);
+            siftDown(first, 0, end, less);
+        }
+    }
+
+    // Hoare partition around the median of the first, middle and last values, at least 3 values.
+    // Returns p such that [first, p) is not after *p and (p, last) is not before it.
+    template <typename T, typename Less>
+    T *partition(T *first, T *last, const Less &less)
+    {
+        T *mid = first + (last - first) / 2;
+        T *back = last - 1;
+        if (less(*mid, *first))
+            swap(*mid, *first);
+        if (less(*back, *mid))
+        {
+            swap(*back, *mid);
+            if (less(*mid, *first))
+                swap(*mid, *first);
+        }
+        // the pivot goes first, *back is a sentinel for the forward scan and the pivot for the backward one
+        swap(*first, *mid);
+        T *i = first;
+        T *j = last;
+        while (true)
+        {
+            while (less(*++i, *first))
+                ;
+            while (less(*first, *--j))
+                ;
+            if (i >= j)
+                break;
+            swap(*i, *j);
+        }
+        swap(*first, *j);
+        return j;
+    }
+
+    // introsort : quicksort falling back to heapsort past 2*log2(n) levels, recursing on the smaller side only
+    template <typename T, typename Less>
+    void introsort(T *first, T *last, size_t depth, const Less &less)
+    {
+        while (last - first > (ptrdiff_t)insertionThreshold)
+        {
+            if (depth == 0)
+            {
+                heapsort(first, last, less);
+                return;
+            }
+            depth--;
+            T *p = partition(first, last, less);
+            if (p - first < last - p)
+            {
+                introsort(first, p, depth, less);
+                first = p + 1;
+            }
+            else
+            {
+                introsort(p + 1, last, depth, less);
+                last = p;
+            }
+        }
+        insertion(first, last, less);
+    }
+
+    template <typename T, typename Less>
+    void sort(T *first, T *last, const Less &less)
+    {
+        if (last - first > 1)
+            introsort(first, last, depthLimit(last - first), less);
+    }
+
+    // introselect : *nth becomes the value it would be once sorted, nothing after it comes before and nothing before it comes after
+    template <typename T, typename Less>
+    void select(T *first, T *nth, T *last, const Less &less)
+    {
+        if (nth >= last)
+            return;
+        size_t depth = depthLimit(last - first);
+        while (last - first > (ptrdiff_t)insertionThreshold)
+        {
+            if (depth == 0)
+            {
+                heapsort(first, last, less);
+                return;
+            }
+            depth--;
+            T *p = partition(first, last, less);
+            if (p == nth)
+                return;
+            if (nth < p)
+                last = p;
+            else
+                first = p + 1;
+        }
+        insertion(first, last, less);
+    }
+
+    template <typename T, typename Less>
+    void partialSort(T *first, T *middle, T *last, const Less &less)
+    {
+        select(first, middle, last, less);
+        sort(first, middle < last ? middle : last, less);
+    }
+
+    template <size_t bytes> struct radixKey;
+    template <> struct radixKey<1> { typedef uint8_t type; };
+    template <> struct radixKey<2> { typedef uint16_t type; };
+    template <> struct radixKey<4> { typedef uint32_t type; };
+    template <> struct radixKey<8> { typedef uint64_t type; };
+
+    // unsigned key ordered like the value : sign bit flipped for two's complement integers,
+    // sign bit flipped for positive IEEE 754 values and every bit for negative ones (NaNs go past the infinities)
+    template <typename T>
+    typename radixKey<sizeof(T)>::type toRadixKey(const T &value, const bool ascending)
+    {
+        typedef typename radixKey<sizeof(T)>::type K;
+        const K sign = K(K(1) << (8 * sizeof(T) - 1));
+        K key;
+        memcpy(&key, &value, sizeof(T));
+        if (std::is_floating_point<T>::value)
+            key = (key & sign) ? K(~key) : K(key | sign);
+        else if (std::is_signed<T>::value)
+            key = K(key ^ sign);
+        return ascending ? key : K(~key);
+    }
+
+    // stable LSD radix sort, one byte per pass, the passes on a byte shared by all the keys are skipped.
+    // buffer holds last - first values.
+    template <typename T>
+    void radix(T *first, T *last, T *buffer, const bool ascending)
+    {
+        static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value, "radix sort needs integer or floating point values");
+        const size_t n = last - first;
+        if (n < 2)
+            return;
+        size_t count[256];
+        T *from = first;
+        T *to = buffer;
+        for (size_t shift = 0; shift < 8 * sizeof(T); shift += 8)
+        {
+            memset(count, 0, sizeof(count));
+            for (size_t i = 0; i < n; i++)
+                count[(toRadixKey(from[i], ascending) >> shift) & 0xFF]++;
+            if (count[(toRadixKey(from[0], ascending) >> shift) & 0xFF] == n)
+                continue;
+            size_t sum = 0;
+            for (size_t b = 0; b < 256; b++)
+            {
+                const size_t c = count[b];
+                count[b] = sum;
+                sum += c;
+            }
+            for (size_t i = 0; i < n; i++)
+                to[count[(toRadixKey(from[i], ascending) >> shift) & 0xFF]++] = from[i];
+            swap(from, to);
+        }
+        if (from != first)
+            memcpy(first, from, n * sizeof(T));
+    }
+} // namespace sorting
+} // namespace internal
+
+#endif
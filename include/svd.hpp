@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SVD_HPP
+#define SVD_HPP
+
+#include "colMajorMatrix.hpp"
+#include "threadPool.hpp"
+#include <limits>
+
+// Singular value decomposition a = U * diag(s) * V^T of a rows x cols matrix (rowMajorMatrix, colMajorMatrix or any MatrixBase), s in
+// descending order, by one-sided Jacobi (Hestenes) : the columns of a (of a^T when rows < cols) are rotated two by two until they are
+// orthogonal, their norms are then the singular values. The pairs are visited in round-robin order, n/2 disjoint pairs per round, and
+// each round is split over the threads of internal::threadPool like the dense kernels. Accurate down to the smallest singular values,
+// ~ 6 * rows * cols^2 flops per sweep and usually 6 to 10 sweeps : meant for small to medium sizes (up to ~100 columns).
+// thin : U is rows x k, V is cols x k, with k = min(rows, cols). full : U is rows x rows and V cols x cols, completed to orthonormal bases.
+// The workspaces are allocated by the constructor : once the outputs have their size, no call touches the heap.
+template <typename T>
+class svd
+{
+public:
+    enum class mode { thin, full };
+
+protected:
+    size_t _rows, _cols;
+    // the columns of a, or of a^T, orthogonalized in place (max x min), and the product of the rotations (min x min)
+    colMajorMatrix<T> W, R;
+    Vector<T> sigma, work;
+    Vector<size_t> order, tournament, rotated;
+
+    size_t large() const noexcept { return W.rows(); }
+    size_t small() const noexcept { return W.cols(); }
+    // tolerance of the orthogonality test : |wj . wl| <= tolerance * |wj| * |wl|
+    T orthogonality() const noexcept { return sqrt(T(large())) * std::numeric_limits<T>::epsilon(); }
+    size_t rotate(const size_t j, const size_t l, const bool vectors);
+    void orthogonalize(const MatrixBase<T> &a, const bool vectors);
+    // out = the normalized columns of W, by decreasing singular value, completed to `columns` orthonormal ones
+    void left(rowMajorMatrix<T> &out, const size_t columns);
+    void right(rowMajorMatrix<T> &out) const;
+
+public:
+    svd(const size_t rows, const size_t cols);
+    svd(const svd &) = delete;
+    svd &operator=(const svd &) = delete;
+
+    size_t rows() const noexcept { return _rows; }
+    size_t cols() const noexcept { return _cols; }
+
+    Vector<T> *singularValues(Vector<T> &s, const MatrixBase<T> &a);
+    svd *compute(Vector<T> &s, rowMajorMatrix<T> &U, rowMajorMatrix<T> &V, const MatrixBase<T> &a, const mode m = mode::thin);
+    // out = V * diag(1 / s) * U^T (cols x rows), the singular values not above tolerance taken as 0.
+    // A negative tolerance stands for max(rows, cols) * epsilon * the largest singular value.
+    rowMajorMatrix<T> *pinv(rowMajorMatrix<T> &out, const MatrixBase<T> &a, T tolerance = -1);
+    // number of singular values of the last decomposition above tolerance (negative : the same default as pinv)
+    size_t rank(T tolerance = -1) const;
+};
+
+#ifndef SVD_CPP
+#include "svd.cpp"
+#endif // SVD_CPP
+
+#endif // SVD_HPP
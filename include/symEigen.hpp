@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYM_EIGEN_HPP
+#define SYM_EIGEN_HPP
+
+#include "symMatrix.hpp"
+
+// Eigendecomposition a = V * diag(values) * V^T of a symMatrix of the given order, the values in ascending order and the eigenvectors
+// in the columns of V. The workspaces are allocated by the constructor : once values and vectors have the right size, compute() makes no
+// heap allocation. Without vectors only the eigenvalues are computed, which skips the accumulation of the transformations.
+// jacobi : cyclic Jacobi rotations on a packed copy of a, quadratically convergent, accurate down to the smallest eigenvalues, ~ 3 * n^3 flops
+// per sweep and usually 6 to 10 sweeps : for small orders.
+// tridiagonal : Householder reduction of the packed copy to a tridiagonal matrix (4/3 * n^3 flops) followed by the QL algorithm with implicit
+// shifts (~ 30 * n flops per eigenvalue without vectors, ~ 6 * n^2 with them) : for larger ones.
+// automatic picks jacobi up to jacobiOrder, tridiagonal above.
+template <typename T>
+class symEigen
+{
+public:
+    enum class method { automatic, jacobi, tridiagonal };
+
+protected:
+    symMatrix<T> A;
+    Vector<T> e, p, beta;
+    size_t _jacobiOrder;
+
+    static size_t at(const size_t i, const size_t j) noexcept { return i >= j ? ((i * (i + 1)) >> 1) + j : ((j * (j + 1)) >> 1) + i; }
+    // sqrt(a^2 + b^2) without overflow
+    static T pythag(const T a, const T b);
+    void jacobi(Vector<T> &values, rowMajorMatrix<T> *vectors);
+    void tridiagonalize(Vector<T> &values, rowMajorMatrix<T> *vectors);
+    void ql(Vector<T> &values, rowMajorMatrix<T> *vectors);
+    void sort(Vector<T> &values, rowMajorMatrix<T> *vectors) const;
+    void decompose(Vector<T> &values, rowMajorMatrix<T> *vectors, const symMatrix<T> &a, const method m);
+
+public:
+    symEigen(const size_t order, const size_t jacobiOrder = 8) : A(order), e(order), p(order), beta(order), _jacobiOrder(jacobiOrder) {}
+    symEigen(const symEigen &) = delete;
+    symEigen &operator=(const symEigen &) = delete;
+
+    size_t order() const noexcept { return A.rows(); }
+    size_t jacobiOrder() const noexcept { return _jacobiOrder; }
+
+    Vector<T> *eigenvalues(Vector<T> &values, const symMatrix<T> &a, const method m = method::automatic);
+    symEigen *compute(Vector<T> &values, rowMajorMatrix<T> &vectors, const symMatrix<T> &a, const method m = method::automatic);
+};
+
+#ifndef SYM_EIGEN_CPP
+#include "symEigen.cpp"
+#endif // SYM_EIGEN_CPP
+
+#endif // SYM_EIGEN_HPP
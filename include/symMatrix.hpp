@@ -42,6 +42,11 @@ class symMatrix : public MatrixBase<T>
         symMatrix(const size_t order) : MatrixBase<T>(order, order){Vector<T>::resize(MatrixBase<T>::minMemorySize(), false, false);};
         symMatrix(const size_t rows, const size_t cols);
 
+        // reductions, accumulated in A
+        template <typename A = typename internal::accumulator<T>::type> A trace() const;
+        // sqrt of the sum of the squares of all the n*n elements, from the packed triangle : 2 * (sum of its squares) - (sum of the squares of the diagonal)
+        template <typename A = typename internal::accumulator<T>::type> A frobeniusNorm() const;
+
         // symMatrix and data_type
         template<typename U> symMatrix<T> *holdAdd(const symMatrix<U> &a, const T &b, const bool checkSize = true){ return (symMatrix<T> *)(checkSize? MatrixBase<T>::resizeLike(a):this)->Vector<T>::holdAdd(a, b, false); };
         template<typename U> symMatrix<T> *holdSub(const symMatrix<U> &a, const T &b, const bool checkSize = true){ return (symMatrix<T> *)(checkSize? MatrixBase<T>::resizeLike(a):this)->Vector<T>::holdSub(a, b, false); };
@@ -55,35 +60,42 @@ class symMatrix : public MatrixBase<T>
         template<typename U, typename V> symMatrix *holdSub(const symMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true){ return (symMatrix *)(checkSize? MatrixBase<T>::checkSize_add(a,b):this)->Vector<T>::holdSub(a, b, false); };
         template<typename U, typename V> symMatrix *holdMul(const symMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         // symMatrix and ldl_matrix
-        template<typename U> symMatrix *holdInv(ldl_matrix<U> &other, const bool checkSize = true);
+        template<typename U, typename A = typename internal::accumulator<T>::type> symMatrix *holdInv(ldl_matrix<U> &other, const bool checkSize = true);
         // rowMajorMatrix and rowMajorMatrix
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
         template<typename U> symMatrix *hold(const rowMajorMatrix<U> &other, const bool checkSize = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U> symMatrix *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename A = typename internal::accumulator<T>::type> symMatrix *holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U> symMatrix *addMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename A = typename internal::accumulator<T>::type> symMatrix *addMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U> symMatrix *subMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename A = typename internal::accumulator<T>::type> symMatrix *subMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize = true, const bool checkOverlap = true);
         // rowMajorMatrix and symMatrix
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
         template<typename U, typename V> symMatrix *holdAdd(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
         template<typename U, typename V> symMatrix *holdSub(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U, typename V> symMatrix *holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         // symMatrix and rowMajorMatrix
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
         template<typename U, typename V> symMatrix *holdSub(const symMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U, typename V> symMatrix *holdMul(const symMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *holdMul(const symMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         // rowMajorMatrix and colMajorMatrix
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U, typename V> symMatrix *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
         // !!! warning: loss of information !!! Normally, this operations give not obviously symmetrical matrices, but it speed up the calculation if you are sure that the result is symmetrical.
-        template<typename U, typename V> symMatrix *addMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *addMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize = true);
         // triangMatrix and uu_triangMatrix
-        template<typename U> symMatrix *holdMul(const triangMatrix<U> &a, const uu_triangMatrix<U> &b, const bool checkSize = true);
+        template<typename U, typename A = typename internal::accumulator<T>::type> symMatrix *holdMul(const triangMatrix<U> &a, const uu_triangMatrix<U> &b, const bool checkSize = true);
+        // this = beta * a + alpha * u * u^T, one pass over the packed triangle (a can be this)
+        template<typename U, typename V> symMatrix *holdAddOuter(const T beta, const symMatrix<U> &a, const T alpha, const Vector<V> &u, const bool checkSize = true);
+        // sum over the columns k of points of weights[k] * (points_k - mean) * (points_k - mean)^T, the deviations computed on the fly along the storage
+        template<typename U, typename V, typename W> symMatrix *holdWeightedCov(const colMajorMatrix<U> &points, const Vector<V> &mean, const Vector<W> &weights, const bool checkSize = true);
+        // csrMatrix and symMatrix : a * b * a^T, only the stored values of a are visited
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *holdSandwich(const csrMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> symMatrix *addSandwich(const csrMatrix<U> &a, const symMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         ////////////////////////// operators //////////////////////////
         // dataType
         symMatrix *operator+=(const T &data) { return (symMatrix *)this->Vector<T>::operator+=(data); };
@@ -150,19 +162,19 @@ namespace operators
     // symMatrix and symMatrix
     template <typename T, typename U, typename V=decltype(T()+U())> internal::tmp<symMatrix<V>> &&operator+(const symMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), a.cols())->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U, typename V=decltype(T()-U())> internal::tmp<symMatrix<V>> &&operator-(const symMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), a.cols())->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V=decltype(T()*U())> internal::tmp<symMatrix<V>> &&operator*(const symMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<symMatrix<V>> &&operator*(const symMatrix<T> &a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize, false)); };
     // tmp symMatrix and symMatrix
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator+(internal::tmp<symMatrix<T>> &&a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<T>>*)a->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator-(internal::tmp<symMatrix<T>> &&a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<T>>*)a->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V=decltype(T()*U())> internal::tmp<symMatrix<V>> &&operator*(internal::tmp<symMatrix<T>> &&a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<symMatrix<V>> &&operator*(internal::tmp<symMatrix<T>> &&a, const symMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b.cols())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
     // symMatrix and tmp symMatrix
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator+(const symMatrix<T> &a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<T>>*)b->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator-(const symMatrix<T> &a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<T>>*)b->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V=decltype(T()*U())> internal::tmp<symMatrix<V>> &&operator*(const symMatrix<T> &a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b->cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<symMatrix<V>> &&operator*(const symMatrix<T> &a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a.rows(), b->cols())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); };
     // tmp symMatrix and tmp symMatrix
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator+(internal::tmp<symMatrix<T>> &&a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<T>>*)a->holdAdd(a, *b.release(), operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator-(internal::tmp<symMatrix<T>> &&a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<T>>*)a->holdSub(a, *b.release(), operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V=decltype(T()*U())> internal::tmp<symMatrix<V>> &&operator*(internal::tmp<symMatrix<T>> &&a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a->rows(), b->cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<symMatrix<V>> &&operator*(internal::tmp<symMatrix<T>> &&a, internal::tmp<symMatrix<U>> &&b) { return internal::move(*(internal::tmp<symMatrix<V>>*)internal::tmp<symMatrix<V>>::get(a->rows(), b->cols())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
     // triangMatrix and uu_triangMatrix
     template <typename T, typename U> internal::tmp<symMatrix<T>> &&operator*(const triangMatrix<T> &a, const uu_triangMatrix<U> &b) { return internal::move(*(internal::tmp<symMatrix<T>>*)internal::tmp<symMatrix<T>>::get(a.rows(), b.cols())->holdMul(a, b, operators::MatrixCheckSize)); };
     // tmp symMatrix and uu_triangMatrix
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include "commun.hpp"
+#include <math.h>
+#include <functional>
+#ifdef NATIVE
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#else
+#include <atomic>
+#endif
+
+namespace internal
+{
+    // worker threads shared by the dense kernels (rowMajorMatrix::holdMul, Vector::holdMul(rowMajorMatrix, Vector), symMatrix::holdMul(rowMajorMatrix, colMajorMatrix), ldl_matrix::decompose)
+    // and by parallel_for and taskGroup (parallel.hpp) : std::thread on NATIVE, FreeRTOS tasks pinned to the other cores otherwise.
+    // Disabled by default (a single thread, the caller), enabled with internal::threadPool::global().resize(std::thread::hardware_concurrency()) or resize(portNUM_PROCESSORS).
+    // A kernel splits its output rows in contiguous blocks, one per thread, when it does at least `threshold` multiply-adds.
+    // Only one kernel is split at a time : the kernels called meanwhile (from other threads or from a block) run on their calling thread.
+    class threadPool
+    {
+    public:
+        static threadPool &global() { static threadPool pool; return pool; }
+        ~threadPool() { resize(1); }
+
+        // minimal number of multiply-adds of a kernel to split it
+        size_t threshold = 1 << 16;
+
+        // number of threads, including the calling one
+        size_t size() const noexcept;
+        // must not be called while a kernel runs
+        void resize(const size_t threads);
+
+        // number of blocks to split a kernel of `work` multiply-adds in
+        size_t partsFor(const size_t work) const noexcept { return work < threshold ? 1 : size(); }
+        // calls task(part) for each part in [0, parts) over the threads and returns when they are all done.
+        // The task is handed to the workers by reference : a kernel step makes no heap allocation, whatever its lambda captures.
+        template <typename F> void run(const size_t parts, const F &task);
+        // calls task(begin, end) over contiguous blocks of [0, count) whose bounds are multiples of align
+        template <typename F> void forBlocks(const size_t count, const size_t align, const size_t work, const F &task);
+
+        // number of rows of rowBytes bytes whose total size is a multiple of a cache line, so that two blocks never write the same line
+        static size_t rowAlign(const size_t rowBytes) noexcept;
+        // bound of the part-th of parts blocks of rows of a lower triangle of order n, so that the blocks have the same number of elements
+        static size_t triangularBound(const size_t n, const size_t part, const size_t parts) noexcept { return part >= parts ? n : (size_t)(n * sqrt((double)part / parts)); }
+
+    private:
+        void dispatch(const size_t parts, const std::function<void(size_t)> &task);
+        static bool &insideTask() { static thread_local bool inside = false; return inside; }
+#ifdef NATIVE
+        threadPool() {}
+        std::vector<std::thread> workers;
+        std::mutex busy; // held by the kernel being split
+        std::mutex mutex; // protects the fields below
+        std::condition_variable wake, done;
+        const std::function<void(size_t)> *task = nullptr;
+        size_t parts = 0, next = 0, pending = 0, generation = 0;
+        bool stop = false;
+        // runs the remaining parts of the current task, mutex locked by lock
+        void runParts(std::unique_lock<std::mutex> &lock);
+        void work();
+#else
+        threadPool() : busy(xSemaphoreCreateMutex()), start(xSemaphoreCreateCounting(portNUM_PROCESSORS * 4, 0)), finished(xSemaphoreCreateCounting(portNUM_PROCESSORS * 4, 0)) {}
+        size_t workers = 0;
+        SemaphoreHandle_t busy; // held by the kernel being split
+        SemaphoreHandle_t start; // given once per worker to start a task (or to stop)
+        SemaphoreHandle_t finished; // given by each worker when it has no more part to run
+        const std::function<void(size_t)> *task = nullptr;
+        size_t parts = 0;
+        std::atomic<size_t> next;
+        bool stop = false;
+        void runParts();
+        static void work(void *pool);
+#endif
+    };
+
+    inline size_t threadPool::rowAlign(const size_t rowBytes) noexcept
+    {
+        const size_t line = 64;
+        size_t a = rowBytes % line, b = line;
+        while (a)
+        {
+            const size_t r = b % a;
+            b = a;
+            a = r;
+        }
+        return line / b;
+    }
+
+    template <typename F>
+    void threadPool::run(const size_t parts, const F &task)
+    {
+        if (parts <= 1)
+        {
+            if (parts)
+                task(0);
+            return;
+        }
+        // a reference_wrapper is stored inside the std::function, without allocation
+        const std::function<void(size_t)> wrapped = std::cref(task);
+        dispatch(parts, wrapped);
+    }
+
+    template <typename F>
+    void threadPool::forBlocks(const size_t count, const size_t align, const size_t work, const F &task)
+    {
+        const size_t blocks = (count + align - 1) / align;
+        size_t parts = partsFor(work);
+        if (parts > blocks)
+            parts = blocks;
+        if (parts <= 1)
+        {
+            task(0, count);
+            return;
+        }
+        run(parts, [&](const size_t part)
+        {
+            const size_t end = part + 1 == parts ? count : blocks * (part + 1) / parts * align;
+            task(blocks * part / parts * align, end);
+        });
+    }
+
+#ifdef NATIVE
+    inline size_t threadPool::size() const noexcept { return workers.size() + 1; }
+
+    inline void threadPool::resize(const size_t threads)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (size_t i = 0; i < workers.size(); i++)
+            workers[i].join();
+        workers.clear();
+        stop = false;
+        for (size_t i = 1; i < threads; i++)
+            workers.push_back(std::thread(&threadPool::work, this));
+    }
+
+    inline void threadPool::runParts(std::unique_lock<std::mutex> &lock)
+    {
+        while (next < parts)
+        {
+            const size_t part = next++;
+            lock.unlock();
+            (*task)(part);
+            lock.lock();
+            if (--pending == 0)
+                done.notify_all();
+        }
+    }
+
+    inline void threadPool::dispatch(const size_t parts, const std::function<void(size_t)> &task)
+    {
+        if (parts <= 1 || workers.empty() || insideTask() || !busy.try_lock())
+        {
+            for (size_t part = 0; part < parts; part++)
+                task(part);
+            return;
+        }
+        insideTask() = true;
+        std::unique_lock<std::mutex> lock(mutex);
+        this->task = &task;
+        this->parts = parts;
+        next = 0;
+        pending = parts;
+        generation++;
+        wake.notify_all();
+        runParts(lock);
+        done.wait(lock, [this]() { return pending == 0; });
+        this->task = nullptr;
+        lock.unlock();
+        insideTask() = false;
+        busy.unlock();
+    }
+
+    inline void threadPool::work()
+    {
+        insideTask() = true;
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [&]() { return stop || generation != seen; });
+            if (stop)
+                return;
+            seen = generation;
+            runParts(lock);
+        }
+    }
+#else
+    inline size_t threadPool::size() const noexcept { return workers + 1; }
+
+    // at most 4 threads per core
+    inline void threadPool::resize(const size_t threads)
+    {
+        stop = true;
+        for (size_t i = 0; i < workers; i++)
+            xSemaphoreGive(start);
+        for (size_t i = 0; i < workers; i++)
+            xSemaphoreTake(finished, portMAX_DELAY);
+        stop = false;
+        const size_t maxThreads = portNUM_PROCESSORS * 4;
+        workers = (threads < maxThreads ? threads : maxThreads) - (threads ? 1 : 0);
+        for (size_t i = 0; i < workers; i++)
+            xTaskCreatePinnedToCore(&threadPool::work, "threadPool", 4096, this, uxTaskPriorityGet(NULL), NULL, (xPortGetCoreID() + 1 + i) % portNUM_PROCESSORS);
+    }
+
+    inline void threadPool::runParts()
+    {
+        for (size_t part = next++; part < parts; part = next++)
+            (*task)(part);
+    }
+
+    inline void threadPool::dispatch(const size_t parts, const std::function<void(size_t)> &task)
+    {
+        if (parts <= 1 || workers == 0 || insideTask() || xSemaphoreTake(busy, 0) != pdTRUE)
+        {
+            for (size_t part = 0; part < parts; part++)
+                task(part);
+            return;
+        }
+        insideTask() = true;
+        this->task = &task;
+        this->parts = parts;
+        next = 0;
+        for (size_t i = 0; i < workers; i++)
+            xSemaphoreGive(start);
+        runParts();
+        for (size_t i = 0; i < workers; i++)
+            xSemaphoreTake(finished, portMAX_DELAY);
+        this->task = nullptr;
+        insideTask() = false;
+        xSemaphoreGive(busy);
+    }
+
+    inline void threadPool::work(void *pool)
+    {
+        threadPool &self = *(threadPool *)pool;
+        insideTask() = true;
+        while (true)
+        {
+            xSemaphoreTake(self.start, portMAX_DELAY);
+            if (self.stop)
+            {
+                xSemaphoreGive(self.finished);
+                vTaskDelete(NULL);
+                return;
+            }
+            self.runParts();
+            xSemaphoreGive(self.finished);
+        }
+    }
+#endif
+} // namespace internal
+
+#endif
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+// Optional instrumentation of the kernels, compiled only when LINEAR_ALGEBRA_TRACE is defined (e.g. build_flags = -DLINEAR_ALGEBRA_TRACE),
+// otherwise the hooks expand to nothing.
+// Each kernel (hold*, holdMul, holdInv, decompose, ...) records one event on return : object, operation, shape, start and duration,
+// and so do internal::tmp::get and the allocations/deallocations of the vectors, into a ring buffer of the last LINEAR_ALGEBRA_TRACE_SIZE events
+// shared by all the threads (lock-free, the oldest events are overwritten).
+// The events are read with trace::snapshot(), exported to the Chrome trace format (chrome://tracing, ui.perfetto.dev) with trace::writeChromeJson() on NATIVE,
+// or streamed with trace::dump(), e.g. over serial, and read back on the host with trace::readDump().
+
+#if defined(LINEAR_ALGEBRA_TRACE) || defined(LINEAR_ALGEBRA_ACCOUNTING)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#ifdef NATIVE
+#include <chrono>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <vector>
+#else
+#include <Arduino.h>
+#endif
+
+// clock shared with the accounting mode (accounting.hpp)
+namespace trace
+{
+    // nanoseconds on NATIVE, cpu cycles otherwise (the counters wrap, only the differences between close events are meaningful)
+    inline uint32_t now() noexcept
+    {
+#ifdef NATIVE
+        return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+        return ESP.getCycleCount();
+#endif
+    }
+    inline uint32_t ticksPerUs() noexcept
+    {
+#ifdef NATIVE
+        return 1000;
+#else
+        return ESP.getCpuFreqMHz();
+#endif
+    }
+} // namespace trace
+
+#endif
+
+#ifdef LINEAR_ALGEBRA_TRACE
+
+#ifndef LINEAR_ALGEBRA_TRACE_SIZE
+#define LINEAR_ALGEBRA_TRACE_SIZE 1024
+#endif
+
+namespace trace
+{
+    static_assert((LINEAR_ALGEBRA_TRACE_SIZE & (LINEAR_ALGEBRA_TRACE_SIZE - 1)) == 0, "LINEAR_ALGEBRA_TRACE_SIZE must be a power of 2");
+
+    enum class object : uint8_t { none, Vector, rowMajorMatrix, colMajorMatrix, diagMatrix, symMatrix, triangMatrix, ul_triangMatrix, uu_triangMatrix, ldl_matrix, csrMatrix, cscMatrix, bandMatrix, blockDiagMatrix, tmp, symEigen, svd, ud_filter, innovationGate, expm };
+    enum class op : uint8_t { none, hold, holdAdd, holdSub, holdMul, holdDiv, holdInv, holdSandwich, holdLDL, holdSolveLDL, decompose, dot, get, alloc, free, sort, select, reduce, map, addMul, subMul, addSandwich, predict, update };
+
+    inline const char *name(const object o)
+    {
+        static const char *const names[] = {"", "Vector", "rowMajorMatrix", "colMajorMatrix", "diagMatrix", "symMatrix", "triangMatrix", "ul_triangMatrix", "uu_triangMatrix", "ldl_matrix", "csrMatrix", "cscMatrix", "bandMatrix", "blockDiagMatrix", "tmp", "symEigen", "svd", "ud_filter", "innovationGate", "expm"};
+        return (size_t)o < sizeof(names) / sizeof(names[0]) ? names[(size_t)o] : "?";
+    }
+    inline const char *name(const op o)
+    {
+        static const char *const names[] = {"", "hold", "holdAdd", "holdSub", "holdMul", "holdDiv", "holdInv", "holdSandwich", "holdLDL", "holdSolveLDL", "decompose", "dot", "get", "alloc", "free", "sort", "select", "reduce", "map", "addMul", "subMul", "addSandwich", "predict", "update"};
+        return (size_t)o < sizeof(names) / sizeof(names[0]) ? names[(size_t)o] : "?";
+    }
+
+    // 20 bytes, written as is (little endian) by dump()
+    // kernels : rows and cols of the result (or of the operand for hold, decompose and dot), tmp::get : number of elements asked,
+    // alloc and free : number of bytes, duration 0
+    struct event
+    {
+        uint32_t start = 0;    // ticks, see ticksPerUs()
+        uint32_t duration = 0; // ticks
+        uint32_t rows = 0;
+        uint32_t cols = 0;
+        object on = object::none;
+        op what = op::none;
+        uint8_t thread = 0;
+        uint8_t reserved = 0;
+    };
+    static_assert(sizeof(event) == 20, "trace::event must be packed in 20 bytes");
+
+    // small id of the calling thread (the core on the target)
+    inline uint8_t thread() noexcept
+    {
+#ifdef NATIVE
+        static std::atomic<uint8_t> count(0);
+        static thread_local uint8_t id = count++;
+        return id;
+#else
+        return (uint8_t)xPortGetCoreID();
+#endif
+    }
+
+    namespace internal
+    {
+        struct ring
+        {
+            event events[LINEAR_ALGEBRA_TRACE_SIZE];
+            // index + 1 of the event held by each slot, 0 while it is written
+            std::atomic<uint32_t> sequence[LINEAR_ALGEBRA_TRACE_SIZE];
+            std::atomic<uint32_t> head;  // index of the next event
+            std::atomic<uint32_t> first; // index of the first event since clear()
+        };
+        inline ring &buffer() { static ring r; return r; }
+    } // namespace internal
+
+    inline void record(const event &e) noexcept
+    {
+        internal::ring &r = internal::buffer();
+        const uint32_t i = r.head.fetch_add(1, std::memory_order_relaxed);
+        std::atomic<uint32_t> &sequence = r.sequence[i & (LINEAR_ALGEBRA_TRACE_SIZE - 1)];
+        sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        r.events[i & (LINEAR_ALGEBRA_TRACE_SIZE - 1)] = e;
+        sequence.store(i + 1, std::memory_order_release);
+    }
+    inline void record(const object on, const op what, const size_t rows, const size_t cols) noexcept
+    {
+        event e;
+        e.start = now();
+        e.rows = (uint32_t)rows;
+        e.cols = (uint32_t)cols;
+        e.on = on;
+        e.what = what;
+        e.thread = thread();
+        record(e);
+    }
+
+    // records an event from its construction to its destruction
+    class scope
+    {
+    private:
+        event e;
+
+    public:
+        scope(const object on, const op what, const size_t rows, const size_t cols) noexcept
+        {
+            e.rows = (uint32_t)rows;
+            e.cols = (uint32_t)cols;
+            e.on = on;
+            e.what = what;
+            e.thread = thread();
+            e.start = now();
+        }
+        ~scope() { e.duration = now() - e.start; record(e); }
+    };
+
+    // number of events recorded since clear(), including the overwritten ones
+    inline size_t recorded() noexcept { return internal::buffer().head.load(std::memory_order_relaxed) - internal::buffer().first.load(std::memory_order_relaxed); }
+    inline size_t capacity() noexcept { return LINEAR_ALGEBRA_TRACE_SIZE; }
+    inline void clear() noexcept { internal::buffer().first.store(internal::buffer().head.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+    // copies the event of index i into e, false if it was overwritten or is being written
+    inline bool read(const uint32_t i, event &e) noexcept
+    {
+        internal::ring &r = internal::buffer();
+        const std::atomic<uint32_t> &sequence = r.sequence[i & (LINEAR_ALGEBRA_TRACE_SIZE - 1)];
+        if (sequence.load(std::memory_order_acquire) != i + 1)
+            return false;
+        e = r.events[i & (LINEAR_ALGEBRA_TRACE_SIZE - 1)];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence.load(std::memory_order_relaxed) == i + 1;
+    }
+
+    // copies the last (at most max) events into out, oldest first, and returns their number
+    inline size_t snapshot(event *out, const size_t max) noexcept
+    {
+        const uint32_t head = internal::buffer().head.load(std::memory_order_acquire);
+        size_t n = recorded();
+        if (n > capacity())
+            n = capacity();
+        if (n > max)
+            n = max;
+        size_t count = 0;
+        for (uint32_t i = head - (uint32_t)n; i != head; i++)
+            if (read(i, out[count]))
+                count++;
+        return count;
+    }
+
+    // writes the last events with write(const uint8_t *data, size_t size), e.g. [](const uint8_t *data, size_t size) { Serial.write(data, size); } :
+    // "LAT1", uint16 event size, uint16 0, uint32 ticksPerUs, uint32 event count, then the events (little endian).
+    // The events overwritten meanwhile are sent with op::none. Returns the number of bytes written.
+    template <typename W>
+    size_t dump(const W &write)
+    {
+        const uint32_t head = internal::buffer().head.load(std::memory_order_acquire);
+        size_t n = recorded();
+        if (n > capacity())
+            n = capacity();
+        const uint8_t magic[4] = {'L', 'A', 'T', '1'};
+        const uint16_t sizes[2] = {sizeof(event), 0};
+        const uint32_t header[2] = {ticksPerUs(), (uint32_t)n};
+        write(magic, sizeof(magic));
+        write((const uint8_t *)sizes, sizeof(sizes));
+        write((const uint8_t *)header, sizeof(header));
+        for (uint32_t i = head - (uint32_t)n; i != head; i++)
+        {
+            event e;
+            if (!read(i, e))
+                e = event();
+            write((const uint8_t *)&e, sizeof(e));
+        }
+        return sizeof(magic) + sizeof(sizes) + sizeof(header) + n * sizeof(event);
+    }
+
+#ifdef NATIVE
+    // reads a dump() into events (skipping the overwritten ones) and returns its ticksPerUs, 0 if it is not a dump
+    inline uint32_t readDump(std::istream &in, std::vector<event> &events)
+    {
+        char magic[4];
+        uint16_t sizes[2];
+        uint32_t header[2];
+        if (!in.read(magic, 4) || magic[0] != 'L' || magic[1] != 'A' || magic[2] != 'T' || magic[3] != '1')
+            return 0;
+        if (!in.read((char *)sizes, sizeof(sizes)) || sizes[0] != sizeof(event) || !in.read((char *)header, sizeof(header)))
+            return 0;
+        events.clear();
+        for (uint32_t i = 0; i < header[1]; i++)
+        {
+            event e;
+            if (!in.read((char *)&e, sizeof(e)))
+                return 0;
+            if (e.what != op::none)
+                events.push_back(e);
+        }
+        return header[0];
+    }
+
+    // Chrome trace event format : one complete event ("X") per kernel and tmp::get, one instant event ("i") per allocation,
+    // timestamps in microseconds from the earliest event
+    inline void writeChromeJson(std::ostream &out, const event *events, const size_t count, const uint32_t ticksPerUs)
+    {
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        // the tick counter wraps : the start of each event is taken relative to the previous one,
+        // and the events are recorded on return, so the earliest start is not the first one
+        int64_t t = 0, first = 0;
+        for (size_t i = 1; i < count; i++)
+            if ((t += (int32_t)(events[i].start - events[i - 1].start)) < first)
+                first = t;
+        t = -first;
+        char line[256];
+        for (size_t i = 0; i < count; i++)
+        {
+            const event &e = events[i];
+            if (i)
+                t += (int32_t)(e.start - events[i - 1].start);
+            const double ts = (double)t / ticksPerUs;
+            const double duration = (double)e.duration / ticksPerUs;
+            if (e.what == op::alloc || e.what == op::free)
+                snprintf(line, sizeof(line), "%s\n{\"name\":\"%s\",\"cat\":\"memory\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"bytes\":%u}}",
+                         i ? "," : "", name(e.what), ts, e.thread, e.rows);
+            else
+                snprintf(line, sizeof(line), "%s\n{\"name\":\"%s::%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"rows\":%u,\"cols\":%u}}",
+                         i ? "," : "", name(e.on), name(e.what), e.on == object::tmp ? "tmp" : "kernel", ts, duration, e.thread, e.rows, e.cols);
+            out << line;
+        }
+        out << "\n]}\n";
+    }
+    // exports the last events of the ring buffer
+    inline void writeChromeJson(std::ostream &out)
+    {
+        std::vector<event> events(capacity());
+        events.resize(snapshot(events.data(), events.size()));
+        writeChromeJson(out, events.data(), events.size(), ticksPerUs());
+    }
+#endif // NATIVE
+
+} // namespace trace
+
+// records the enclosing kernel, e.g. LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+#define LINEAR_ALGEBRA_TRACE_SCOPE(object_, op_, rows, cols) trace::scope _traceScope(trace::object::object_, trace::op::op_, rows, cols)
+// records an instant event, e.g. LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, N * sizeof(T), 0);
+#define LINEAR_ALGEBRA_TRACE_EVENT(object_, op_, rows, cols) trace::record(trace::object::object_, trace::op::op_, rows, cols)
+
+#else
+
+#define LINEAR_ALGEBRA_TRACE_SCOPE(object_, op_, rows, cols)
+#define LINEAR_ALGEBRA_TRACE_EVENT(object_, op_, rows, cols)
+
+#endif // LINEAR_ALGEBRA_TRACE
+
+#endif // TRACE_HPP
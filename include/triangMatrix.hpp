@@ -37,6 +37,7 @@ class triangMatrix : public MatrixBase<T>
         const T &operator()(const size_t row, const size_t col) const override{ return (row >= col) ? this->_begin[((row * (row + 1)) >> 1) + col] : internal::_zero<T>; };
         triangMatrix() : MatrixBase<T>(){};
         triangMatrix(const size_t order) : MatrixBase<T>(order, order){Vector<T>::resize(MatrixBase<T>::minMemorySize());};
+        template <typename A = typename internal::accumulator<T>::type> A trace() const;
 
         // triangMatrix and dataTpe
         template <typename U> triangMatrix *holdAdd(const triangMatrix<U> &a, const T &b, const bool checkSize = true){ return (triangMatrix *)(checkSize? MatrixBase<T>::resizeLike(a):this)->Vector<T>::holdAdd(a, b, false); };
@@ -50,7 +51,7 @@ class triangMatrix : public MatrixBase<T>
         template<typename U> triangMatrix *hold(const triangMatrix<U> &other, const bool checkSize = true){ return (triangMatrix *)(checkSize? MatrixBase<T>::resizeLike(other):this)->Vector<T>::hold(other, false); };
         template<typename U, typename V> triangMatrix *holdAdd(const triangMatrix<U> &a, const triangMatrix<V> &b, const bool checkSize = true){ return (triangMatrix *)(checkSize? MatrixBase<T>::checkSize_add(a, b):this)->Vector<T>::holdAdd(a, b, false); };
         template<typename U, typename V> triangMatrix *holdSub(const triangMatrix<U> &a, const triangMatrix<V> &b, const bool checkSize = true){ return (triangMatrix *)(checkSize? MatrixBase<T>::checkSize_add(a, b):this)->Vector<T>::holdSub(a, b, false); };
-        template<typename U, typename V> triangMatrix *holdMul(const triangMatrix<U> &a, const triangMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> triangMatrix *holdMul(const triangMatrix<U> &a, const triangMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         // ul_triangMatrix and diagMatrix
         template<typename U, typename V> triangMatrix *holdMul(const ul_triangMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize = true);
         // ...
@@ -94,23 +95,23 @@ namespace operators
     // triangMatrix and tmp triangMatrix
     template <typename T, typename U> internal::tmp<triangMatrix<U>> &&operator+(const triangMatrix<T> &a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<U>>*)b->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<triangMatrix<U>> &&operator-(const triangMatrix<T> &a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<U>>*)b->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(const triangMatrix<T> &a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); }; 
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(const triangMatrix<T> &a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); }; 
     // tmp triangMatrix and triangMatrix
     template <typename T, typename U> internal::tmp<triangMatrix<T>> &&operator+(internal::tmp<triangMatrix<T>> &&a, const triangMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<T>>*)a->holdAdd(b, a, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<triangMatrix<T>> &&operator-(internal::tmp<triangMatrix<T>> &&a, const triangMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<T>>*)a->holdSub(b, a, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<triangMatrix<T>> &&a, const triangMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(b.rows())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<triangMatrix<T>> &&a, const triangMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(b.rows())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
     // tmp triangMatrix and tmp triangMatrix
     template <typename T, typename U> internal::tmp<triangMatrix<T>> &&operator+(internal::tmp<triangMatrix<T>> &&a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<T>>*)a->holdAdd(*b.release(), a, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<triangMatrix<T>> &&operator-(internal::tmp<triangMatrix<T>> &&a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<T>>*)a->holdSub(*b.release(), a, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<triangMatrix<T>> &&a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<triangMatrix<T>> &&a, internal::tmp<triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
     // ul_triangMatrix and diagMatrix
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
     // tmp ul_triangMatrix and diagMatrix
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), b, operators::MatrixCheckSize)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, const diagMatrix<U> &b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), b, operators::MatrixCheckSize)); };
     // ul_triangMatrix and tmp diagMatrix
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize)); };
     // tmp ul_triangMatrix and tmp diagMatrix
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<diagMatrix<U>> &&b) { return internal::move(*(internal::tmp<triangMatrix<V>>*)internal::tmp<triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize)); };
 }   
 
 #ifndef TRIANG_MATRIX_CPP
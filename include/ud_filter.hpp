@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UD_FILTER_HPP
+#define UD_FILTER_HPP
+
+#include "ldl_Matrix.hpp"
+#include "rowMajorMatrix.hpp"
+
+// Bierman-Thornton Kalman filter of N states driven by K process noises.
+// The covariance is never formed : it is kept as P = L*D*L^T in P.L (unit lower, packed) and P.D, which are the only storage updated.
+// predict() uses Thornton's modified weighted Gram-Schmidt on [F*L | G] with the weights [D | Q], O(N^2*(N+K)).
+// update() processes scalar measurements one at a time with Bierman's algorithm, O(N^2) each, so R must be diagonal (decorrelate the measurements beforehand).
+// Neither refactors P nor inverts anything, D stays positive in float where P -= K*H*P does not.
+// Every workspace is allocated by the constructor : predict() and update() make no heap allocation.
+template <typename T, size_t N, size_t K = N>
+class ud_filter
+{
+protected:
+    rowMajorMatrix<T> W;    // [F*L | G], orthogonalized in place
+    Vector<T> weights;      // [D | Q]
+    Vector<T> c, f, v, fx;
+    Vector<T> k;            // gain of the last scalar update
+    T alpha = 0;            // innovation variance of the last scalar update
+    // x += k*innovation, with k computed from the measurement row h (N values) of variance r
+    template <typename A = typename internal::accumulator<T>::type> ud_filter *updateScalar(const T innovation, const T *h, const T r);
+
+public:
+    Vector<T> x;          // state
+    ldl_matrix<T> P;      // state covariance, factored in P.L and P.D (the packed symmetric part of P is not used)
+    rowMajorMatrix<T> F;  // state transition (or its jacobian)
+    rowMajorMatrix<T> G;  // process noise input, identity by default
+    diagMatrix<T> Q;      // process noise variances
+
+    ud_filter();
+    ud_filter(const ud_filter &) = delete;
+    ud_filter &operator=(const ud_filter &) = delete;
+
+    // factors a full covariance into P.L and P.D
+    ud_filter *setCovariance(const symMatrix<T> &covariance);
+    // out = L*D*L^T
+    template <typename A = typename internal::accumulator<T>::type> symMatrix<T> *getCovariance(symMatrix<T> &out) const;
+
+    // x = F*x, P = F*P*F^T + G*Q*G^T
+    ud_filter *predict();
+    // x = fx (nonlinear transition, F being its jacobian), P = F*P*F^T + G*Q*G^T
+    ud_filter *predict(const Vector<T> &fx);
+
+    // scalar measurement z = h*x + noise of variance r
+    template <typename A = typename internal::accumulator<T>::type> ud_filter *update(const T z, const Vector<T> &h, const T r);
+    // scalar measurement z predicted by hx (nonlinear), h being the jacobian row
+    ud_filter *update(const T z, const T hx, const Vector<T> &h, const T r) { return updateScalar(z - hx, h.begin(), r); }
+    // z = H*x + noise of diagonal covariance R, processed row by row
+    template <typename A = typename internal::accumulator<T>::type> ud_filter *update(const Vector<T> &z, const rowMajorMatrix<T> &H, const diagMatrix<T> &R);
+
+    // of the last scalar update
+    const Vector<T> &gain() const noexcept { return k; }
+    T innovationVariance() const noexcept { return alpha; }
+};
+
+#ifndef UD_FILTER_CPP
+#include "ud_filter.cpp"
+#endif // UD_FILTER_CPP
+
+#endif // UD_FILTER_HPP
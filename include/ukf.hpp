@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UKF_HPP
+#define UKF_HPP
+
+#include "symMatrix.hpp"
+#include "colMajorMatrix.hpp"
+#include <functional>
+
+// Unscented Kalman filter of N states and M measurements, with additive noises.
+// The 2N+1 sigma points are the columns of a colMajorMatrix : each point is contiguous, and the models are evaluated on all of them in one call.
+// They are spread along the columns of L*sqrt(D), with P = L*D*L^T factored in place by an ldl_matrix, and the moments are computed by fused kernels into packed symMatrix.
+// Every workspace is allocated by the constructor : predict() and update() make no heap allocation.
+template <typename T, size_t N, size_t M>
+class ukf
+{
+public:
+    // column k of out = f(column k of points, u), for the 2N+1 columns
+    typedef std::function<void(colMajorMatrix<T> &out, const colMajorMatrix<T> &points, const Vector<T> &u)> transition;
+    // column k of out = h(column k of points), for the 2N+1 columns
+    typedef std::function<void(colMajorMatrix<T> &out, const colMajorMatrix<T> &points)> measurement;
+
+protected:
+    transition f;
+    measurement h;
+    colMajorMatrix<T> X;  // sigma points, N x (2N+1)
+    colMajorMatrix<T> FX; // f(X)
+    colMajorMatrix<T> HX; // h(X), M x (2N+1)
+    Vector<T> wm, wc;     // weights of the mean and of the covariances
+    T spread;             // sqrt(N + lambda)
+    ldl_matrix<T> factor; // of P
+    ldl_matrix<T> S;
+    rowMajorMatrix<T> C, W, K; // C = cross covariance of z and x (M x N), W = S^-1*C = K^T
+    colMajorMatrix<T> Wt;      // transposed view of W
+    Vector<T> zp, y, noControl;
+    // X = x, x + spread*columns of L*sqrt(D), x - spread*columns of L*sqrt(D)
+    ukf *sigmaPoints();
+
+public:
+    Vector<T> x;    // state
+    symMatrix<T> P; // state covariance
+    symMatrix<T> Q; // process noise covariance
+    symMatrix<T> R; // measurement noise covariance
+
+    // lambda = alpha^2*(N + kappa) - N, beta = 2 is optimal for gaussian distributions
+    ukf(const transition &f, const measurement &h, const T alpha = 1, const T beta = 2, const T kappa = 0);
+    ukf(const ukf &) = delete;
+    ukf &operator=(const ukf &) = delete;
+
+    // x = sum of wm*f(X, u), P = sum of wc*(f(X, u) - x)*(f(X, u) - x)^T + Q
+    ukf *predict(const Vector<T> &u);
+    ukf *predict() { return predict(noControl); }
+    // sigma points redrawn around x, S = cov(h(X)) + R, K = cov(x, h(X))*S^-1, x += K*(z - mean(h(X))), P -= K*S*K^T
+    ukf *update(const Vector<T> &z);
+
+    // of the last update
+    const Vector<T> &innovation() const noexcept { return y; }
+    const Vector<T> &predictedMeasurement() const noexcept { return zp; }
+    // S, with its factor in S.L and S.D
+    const ldl_matrix<T> &innovationCovariance() const noexcept { return S; }
+    const rowMajorMatrix<T> &gain() const noexcept { return K; }
+    const colMajorMatrix<T> &sigma() const noexcept { return X; }
+};
+
+#ifndef UKF_CPP
+#include "ukf.cpp"
+#endif // UKF_CPP
+
+#endif // UKF_HPP
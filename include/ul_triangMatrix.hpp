@@ -37,6 +37,8 @@ class ul_triangMatrix : public MatrixBase<T>
         const T &operator()(const size_t row, const size_t col) const override {return (row > col)? this->_begin[(((row-1) * row) >> 1) + col]: (row == col)? internal::_one<T>: internal::_zero<T>;};
         ul_triangMatrix() : MatrixBase<T>(){};
         ul_triangMatrix(const size_t order) : MatrixBase<T>(order, order){Vector<T>::resize(MatrixBase<T>::minMemorySize());};
+        // unit diagonal
+        template <typename A = typename internal::accumulator<T>::type> A trace() const { return A(this->_rows); }
 
         // ul_triangMatrix and dataTpe
         template <typename U> ul_triangMatrix *holdAdd(const ul_triangMatrix<U> &a, const T &b, const bool checkSize = true){ return (ul_triangMatrix *)(checkSize? MatrixBase<T>::resizeLike(a):this)->Vector<T>::holdAdd(a, b, false); };
@@ -50,11 +52,11 @@ class ul_triangMatrix : public MatrixBase<T>
         template<typename U> ul_triangMatrix *hold(const ul_triangMatrix<U> &other, const bool checkSize = true){ return (ul_triangMatrix *)(checkSize? MatrixBase<T>::resizeLike(other):this)->Vector<T>::hold(other, false); };
         template<typename U, typename V> ul_triangMatrix *holdAdd(const ul_triangMatrix<U> &a, const ul_triangMatrix<V> &b, const bool checkSize = true){ return (ul_triangMatrix *)(checkSize? MatrixBase<T>::checkSize_add(a, b):this)->Vector<T>::holdAdd(a, b, false); };
         template<typename U, typename V> ul_triangMatrix *holdSub(const ul_triangMatrix<U> &a, const ul_triangMatrix<V> &b, const bool checkSize = true){ return (ul_triangMatrix *)(checkSize? MatrixBase<T>::checkSize_add(a, b):this)->Vector<T>::holdSub(a, b, false); };
-        template<typename U, typename V> ul_triangMatrix *holdMul(const ul_triangMatrix<U> &a, const ul_triangMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
+        template<typename U, typename V, typename A = typename internal::accumulator<T>::type> ul_triangMatrix *holdMul(const ul_triangMatrix<U> &a, const ul_triangMatrix<V> &b, const bool checkSize = true, const bool checkOverlap = true);
         // ul_triangMatrix and u_ul_triangMatrix
         // ...
 
-        template <typename U> ul_triangMatrix *holdInv(const ul_triangMatrix<U> &other, const bool checkSize = true);
+        template <typename U, typename A = typename internal::accumulator<T>::type> ul_triangMatrix *holdInv(const ul_triangMatrix<U> &other, const bool checkSize = true);
 
         ////////////////////////// operators //////////////////////////
         // dataTpe
@@ -96,15 +98,15 @@ namespace operators
     // ul_triangMatrix and tmp ul_triangMatrix
     template <typename T, typename U> internal::tmp<ul_triangMatrix<U>> &&operator+(const ul_triangMatrix<T> &a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<U>>*)b->holdAdd(a, b, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<ul_triangMatrix<U>> &&operator-(const ul_triangMatrix<T> &a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<U>>*)b->holdSub(a, b, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<ul_triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); }; 
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<ul_triangMatrix<V>> &&operator*(const ul_triangMatrix<T> &a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(a.rows())->holdMul(a, *b.release(), operators::MatrixCheckSize, false)); }; 
     // tmp ul_triangMatrix and ul_triangMatrix
     template <typename T, typename U> internal::tmp<ul_triangMatrix<T>> &&operator+(internal::tmp<ul_triangMatrix<T>> &&a, const ul_triangMatrix<U> &b) { return internal::move(*(internal::tmp<ul_triangMatrix<T>>*)a->holdAdd(b, a, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<ul_triangMatrix<T>> &&operator-(internal::tmp<ul_triangMatrix<T>> &&a, const ul_triangMatrix<U> &b) { return internal::move(*(internal::tmp<ul_triangMatrix<T>>*)a->holdSub(b, a, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<ul_triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, const ul_triangMatrix<U> &b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(b.rows())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<ul_triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, const ul_triangMatrix<U> &b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(b.rows())->holdMul(*a.release(), b, operators::MatrixCheckSize, false)); };
     // tmp ul_triangMatrix and tmp ul_triangMatrix
     template <typename T, typename U> internal::tmp<ul_triangMatrix<T>> &&operator+(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<T>>*)a->holdAdd(*b.release(), a, operators::MatrixCheckSize)); };
     template <typename T, typename U> internal::tmp<ul_triangMatrix<T>> &&operator-(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<T>>*)a->holdSub(*b.release(), a, operators::MatrixCheckSize)); };
-    template <typename T, typename U, typename V = decltype(T()*U())> internal::tmp<ul_triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
+    template <typename T, typename U, typename V = typename internal::storage<decltype(T() * U())>::type> internal::tmp<ul_triangMatrix<V>> &&operator*(internal::tmp<ul_triangMatrix<T>> &&a, internal::tmp<ul_triangMatrix<U>> &&b) { return internal::move(*(internal::tmp<ul_triangMatrix<V>>*)internal::tmp<ul_triangMatrix<V>>::get(a->rows())->holdMul(*a.release(), *b.release(), operators::MatrixCheckSize, false)); };
 }
 
 #ifndef UL_TRIANG_MATRIX_CPP
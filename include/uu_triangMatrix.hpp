@@ -37,6 +37,8 @@ class uu_triangMatrix : public MatrixBase<T>
         const T &operator()(const size_t row, const size_t col) const override {return (col > row)? this->_begin[(((col-1) * col) >> 1) + row]: (row == col)? internal::_one<T>: internal::_zero<T>;};
         uu_triangMatrix() : MatrixBase<T>(){};
         uu_triangMatrix(const size_t order) : MatrixBase<T>(order, order){Vector<T>::resize(MatrixBase<T>::minMemorySize());};
+        // unit diagonal
+        template <typename A = typename internal::accumulator<T>::type> A trace() const { return A(this->_rows); }
 
         // uu_triangMatrix and dataTpe
         template <typename U> uu_triangMatrix *holdAdd(const uu_triangMatrix<U> &a, const T &b, const bool checkSize = true){ return (uu_triangMatrix *)(checkSize? MatrixBase<T>::resizeLike(a):this)->Vector<T>::holdAdd(a, b, false); };
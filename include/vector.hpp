@@ -27,6 +27,10 @@ template <typename T>
 class Vector
 {
     template <typename U> friend class Vector;
+    template <typename U> friend class csrMatrix;
+    template <typename U> friend class cscMatrix;
+    template <typename U> friend class blockDiagMatrix;
+    template <typename U> friend class ringBuffer;
     friend class internal::tmp<Vector>;
 protected:
     T *_begin = nullptr;
@@ -55,20 +59,71 @@ public:
     Vector *insert(const T &value, const size_t index);
     Vector *push_back(const T &value);
     Vector *pop_back();
+    // introsort, O(n log n), equal values may be reordered
     Vector *sort(const bool ascending = true);
-    template<typename U, typename V = decltype(T()*U())> V dot(const Vector<U> &other, const bool checkSize = true);
+    // stable radix sort of integer or floating point values, O(n), with a scratch vector taken from the tmp pool
+    Vector *radixSort(const bool ascending = true);
+    // indices_holder[i] is the index of the i-th value once sorted, equal values keep their order
+    Vector<size_t> *argsort(Vector<size_t> &indices_holder, const bool ascending = true) const;
+    // puts at index k the value it would have once sorted, with no value ordered after it before and none ordered before it after, O(n) on average.
+    // Index n/2 gives the median, k = q*(n-1) the q quantile
+    Vector *nthElement(const size_t k, const bool ascending = true);
+    // sorts the k first values as the whole vector would be, the others are left in an unspecified order, O(n + k log k)
+    Vector *partialSort(const size_t k, const bool ascending = true);
+    // reductions, accumulated in A over 4 independent partial sums
+    template <typename A = typename internal::accumulator<T>::type> A sum() const;
+    template <typename A = typename internal::accumulator<T>::type> A norm1() const;
+    template <typename A = typename internal::accumulator<T>::type> A norm2() const;
+    template <typename A = typename internal::accumulator<T>::type> A norm2Squared() const;
+    T normInf() const;
+    // smallest and greatest values and the index of their first occurrence, throw on an empty vector
+    T minimum() const;
+    T maximum() const;
+    const size_t argmin() const;
+    const size_t argmax() const;
+    template <typename A = typename internal::accumulator<T>::type> A mean() const;
+    // two pass variance, divided by n - 1 if sample, else by n
+    template <typename A = typename internal::accumulator<T>::type> A variance(const bool sample = false) const;
+    template<typename U, typename V = typename internal::accumulator<decltype(T() * U())>::type> V dot(const Vector<U> &other, const bool checkSize = true);
     Vector *fill(const T val);
     Vector *hold(T *begin, const size_t N, const bool checkSize = true);
 
     Vector *hold(const Vector &v, const bool checkSize = true);
     // matrixBase and vector
-    template<typename U, typename V> Vector *holdMul(const MatrixBase<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const MatrixBase<U> &a, const Vector<V> &b, const bool checkSize = true);
     // rowMajorMatrix and vector
-    template<typename U, typename V> Vector *holdMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
-    template<typename U, typename V> Vector *addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // csrMatrix and vector
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const csrMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *addMul(const csrMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // cscMatrix and vector
+    template<typename U, typename V> Vector *holdMul(const cscMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V> Vector *addMul(const cscMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // bandMatrix and vector
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const bandMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *addMul(const bandMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // solve L*D*L^T * x = b, with the factor given by bandMatrix::holdLDL()
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdSolveLDL(const bandMatrix<U> &factor, const Vector<V> &b, const bool checkSize = true);
+    // solve L*D*L^T * x = b, with the factor given by ldl_matrix::decompose()
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdSolveLDL(const ldl_matrix<U> &factor, const Vector<V> &b, const bool checkSize = true);
+    // blockDiagMatrix and vector
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const blockDiagMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *addMul(const blockDiagMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // solve L*D*L^T * x = b, with the factor given by blockDiagMatrix::holdLDL()
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdSolveLDL(const blockDiagMatrix<U> &factor, const Vector<V> &b, const bool checkSize = true);
     template <typename U> Vector *hold(const Vector<U> &v, const bool checkSize = true);
-    // symMatrix and vector
-    // template<typename U, typename V> Vector *holdMul(const symMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
+    // sums of the rows and of the columns of a matrix, the ones along the storage accumulated in A, the others in T
+    template<typename U, typename A = typename internal::accumulator<T>::type> Vector *holdRowSum(const rowMajorMatrix<U> &a, const bool checkSize = true);
+    template<typename U, typename A = typename internal::accumulator<T>::type> Vector *holdColSum(const rowMajorMatrix<U> &a, const bool checkSize = true);
+    template<typename U, typename A = typename internal::accumulator<T>::type> Vector *holdRowSum(const colMajorMatrix<U> &a, const bool checkSize = true);
+    template<typename U, typename A = typename internal::accumulator<T>::type> Vector *holdColSum(const colMajorMatrix<U> &a, const bool checkSize = true);
+    // inclusive prefix sums, this[i] = v[0] + ... + v[i] accumulated in A, v can be this
+    template<typename U, typename A = typename internal::accumulator<T>::type> Vector *holdCumSum(const Vector<U> &v, const bool checkSize = true);
+    // sum of the columns of a (the points, e.g. sigma points) weighted by weights, along the storage
+    template<typename U, typename V> Vector *holdWeightedMean(const colMajorMatrix<U> &points, const Vector<V> &weights, const bool checkSize = true);
+    // symMatrix and vector : one pass over the packed triangle, b must not be this
+    template<typename U, typename V, typename A = typename internal::accumulator<T>::type> Vector *holdMul(const symMatrix<U> &a, const Vector<V> &b, const bool checkSize = true);
     template <typename U, typename V> Vector *holdAdd(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize = true);
     template <typename U, typename V> Vector *holdSub(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize = true);
     template <typename U, typename V> Vector *holdMul(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize = true);
@@ -80,6 +135,20 @@ public:
     template <typename U> Vector *holdSub(const T val, const Vector<U> &v, const bool checkSize = true);
     template <typename U> Vector *holdDiv(const T val, const Vector<U> &v, const bool checkSize = true);
 
+    // elementwise functions : this[i] = f(v[i])
+    template <typename U, typename F> Vector *holdMap(const Vector<U> &v, const F &f, const bool checkSize = true);
+    // accuracy::full calls the libm function of U, accuracy::fast the float approximation of fastMath.hpp (error documented there)
+    template <typename U> Vector *holdSqrt(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdRsqrt(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdExp(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdLog(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdSin(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdCos(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U> Vector *holdTanh(const Vector<U> &v, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    template <typename U, typename V> Vector *holdAtan2(const Vector<U> &y, const Vector<V> &x, const fastMath::accuracy accuracy = fastMath::accuracy::full, const bool checkSize = true);
+    // divides by the L2 norm in place : one reduction, one reciprocal square root, one scaling pass. A null vector is left as is
+    template <typename A = typename internal::accumulator<T>::type> Vector *normalize(const fastMath::accuracy accuracy = fastMath::accuracy::full);
+
 
 
     T &operator[](const size_t i) { return _begin[i]; }
@@ -167,6 +236,14 @@ namespace operators
     
     // rowMajorMatrix and Vector
     template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const rowMajorMatrix<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
+    // csrMatrix and Vector
+    template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const csrMatrix<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
+    // cscMatrix and Vector
+    template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const cscMatrix<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
+    // bandMatrix and Vector
+    template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const bandMatrix<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
+    // blockDiagMatrix and Vector
+    template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const blockDiagMatrix<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
     // MatrixBase and Vector
     template<typename T, typename U> internal::tmp<Vector<T>> &&operator*(const MatrixBase<T> &a, const Vector<U> &b) { return internal::move(*(internal::tmp<Vector<T>>*)internal::tmp<Vector<T>>::get(a.rows())->holdMul(a, b, operators::MatrixCheckSize)); };
 } // namespace operator
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BAND_MATRIX_CPP
+#include "bandMatrix.hpp"
+
+template <typename T>
+const bandMatrix<T> bandMatrix<T>::staticHelper;
+
+template <typename T>
+bandMatrix<T> *bandMatrix<T>::swap(bandMatrix<T> &other) noexcept
+{
+    size_t tmp = _kl;
+    _kl = other._kl;
+    other._kl = tmp;
+    tmp = _ku;
+    _ku = other._ku;
+    other._ku = tmp;
+    MatrixBase<T>::swap(other);
+    return this;
+}
+
+template <typename T>
+T &bandMatrix<T>::operator()(const size_t row, const size_t col)
+{
+    if (!inBand(row, col))
+        throw "bandMatrix::operator() out of the band";
+    return this->_begin[row * width() + col + _kl - row];
+}
+
+template <typename T>
+bandMatrix<T> *bandMatrix<T>::resize(const size_t rows, const size_t cols, const size_t kl, const size_t ku, const bool deallocIfPossible, const bool saveData)
+{
+    if (rows == this->_rows && cols == this->_cols && kl == _kl && ku == _ku && this->_begin != nullptr)
+        return this;
+    // the layout of the rows only depends on the bandwidths
+    const bool sameLayout = kl == _kl && ku == _ku;
+    this->_rows = rows;
+    this->_cols = cols;
+    _kl = kl;
+    _ku = ku;
+    Vector<T>::resize(minMemorySize(rows, cols, kl, ku), deallocIfPossible, saveData && sameLayout);
+    return this;
+}
+
+template <typename T>
+bandMatrix<T> *bandMatrix<T>::hold(const bandMatrix<T> &other, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(bandMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), accounting::bytes(other));
+    if (checkSize)
+        resize(other._rows, other._cols, other._kl, other._ku, false, false);
+    Vector<T>::hold(other, false);
+    return this;
+}
+
+template <typename T>
+template <typename U>
+bandMatrix<T> *bandMatrix<T>::hold(const rowMajorMatrix<U> &other, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(bandMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, (uint64_t)other.rows() * width() * sizeof(U), (uint64_t)other.rows() * width() * sizeof(T));
+    if (checkSize)
+        resize(other._rows, other._cols, false, false);
+    const size_t w = width();
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        const size_t first = (i > _kl) ? i - _kl : 0;
+        const size_t last = (i + _ku + 1 < this->_cols) ? i + _ku + 1 : this->_cols;
+        T *row = this->_begin + i * w + _kl - i;
+        const U *other_row = other._begin + i * other._cols;
+        for (size_t j = first; j < last; j++)
+            row[j] = other_row[j];
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+bandMatrix<T> *bandMatrix<T>::holdLDL(const bandMatrix<U> &a, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(bandMatrix, holdLDL, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.rows() * (3 * a._kl * (a._kl - 1) / 2 + 4 * a._kl), (uint64_t)a.rows() * (a._kl + 1) * sizeof(U), (uint64_t)a.rows() * (a._kl + 1) * sizeof(T));
+    if (checkSize)
+    {
+        if (a._rows != a._cols)
+            throw "bandMatrix::holdLDL() not a square matrix";
+        resize(a._rows, a._cols, a._kl, 0, false, false);
+    }
+    // this(i,j) = L(i,j) for j < i and this(i,i) = D(i)
+    const size_t b = _kl;
+    const size_t w = b + 1;
+    const size_t aw = a.width();
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        const size_t first = (i > b) ? i - b : 0;
+        T *l_i = this->_begin + i * w + b - i;
+        const U *a_i = a._begin + i * aw + a._kl - i;
+        for (size_t j = first; j < i; j++)
+        {
+            const T *l_j = this->_begin + j * w + b - j;
+            A sum = a_i[j];
+            // L(j,k) is zero for k < j-b <= i-b, the range starts at first
+            for (size_t k = first; k < j; k++)
+                sum -= l_i[k] * l_j[k] * this->_begin[k * w + b];
+            l_i[j] = sum / l_j[j];
+        }
+        A d = a_i[i];
+        for (size_t k = first; k < i; k++)
+            d -= l_i[k] * l_i[k] * this->_begin[k * w + b];
+        l_i[i] = d;
+    }
+    return this;
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BLOCK_DIAG_MATRIX_CPP
+#include "blockDiagMatrix.hpp"
+
+template <typename T>
+const blockDiagMatrix<T> blockDiagMatrix<T>::staticHelper;
+
+template <typename T>
+blockDiagMatrix<T> *blockDiagMatrix<T>::swap(blockDiagMatrix<T> &other) noexcept
+{
+    MatrixBase<T>::swap(other);
+    _blockStart.swap(other._blockStart);
+    _blockOffset.swap(other._blockOffset);
+    _blockSym.swap(other._blockSym);
+    return this;
+}
+
+template <typename T>
+const size_t blockDiagMatrix<T>::findBlock(const size_t index) const noexcept
+{
+    // binary search of the block containing the row (or column) index
+    size_t first = 0;
+    size_t last = blocks();
+    while (last - first > 1)
+    {
+        const size_t middle = (first + last) >> 1;
+        if (_blockStart[middle] <= index)
+            first = middle;
+        else
+            last = middle;
+    }
+    return first;
+}
+
+template <typename T>
+const size_t blockDiagMatrix<T>::localIndex(const size_t block, const size_t row, const size_t col) const noexcept
+{
+    const size_t start = _blockStart[block];
+    const size_t r = row - start;
+    const size_t c = col - start;
+    if (!_blockSym[block])
+        return _blockOffset[block] + r * (_blockStart[block + 1] - start) + c;
+    return _blockOffset[block] + ((r >= c) ? ((r * (r + 1)) >> 1) + c : ((c * (c + 1)) >> 1) + r);
+}
+
+template <typename T>
+T &blockDiagMatrix<T>::operator()(const size_t row, const size_t col)
+{
+    if (row >= this->_rows || col >= this->_cols)
+        throw "blockDiagMatrix::operator() out of range";
+    const size_t block = findBlock(row);
+    if (col < _blockStart[block] || col >= _blockStart[block + 1])
+        throw "blockDiagMatrix::operator() out of the blocks";
+    return this->_begin[localIndex(block, row, col)];
+}
+
+template <typename T>
+const T &blockDiagMatrix<T>::operator()(const size_t row, const size_t col) const
+{
+    if (row >= this->_rows || col >= this->_cols)
+        return internal::_zero<T>;
+    const size_t block = findBlock(row);
+    if (col < _blockStart[block] || col >= _blockStart[block + 1])
+        return internal::_zero<T>;
+    return this->_begin[localIndex(block, row, col)];
+}
+
+template <typename T>
+blockDiagMatrix<T> *blockDiagMatrix<T>::clear()
+{
+    this->_rows = 0;
+    this->_cols = 0;
+    _blockStart.resize(1, false, false);
+    _blockStart[0] = 0;
+    _blockOffset.resize(1, false, false);
+    _blockOffset[0] = 0;
+    _blockSym.resize(0, false, false);
+    Vector<T>::resize(0, false, false);
+    return this;
+}
+
+template <typename T>
+blockDiagMatrix<T> *blockDiagMatrix<T>::resize(const size_t rows, const size_t cols, const bool deallocIfPossible, const bool saveData)
+{
+    if (rows != cols)
+        throw "blockDiagMatrix::resize() not a square matrix";
+    if (rows == this->_rows && blocks() == 1 && !_blockSym[0])
+        return this;
+    clear();
+    if (rows > 0)
+        appendBlock(rows, false);
+    return this;
+}
+
+template <typename T>
+T *blockDiagMatrix<T>::appendBlock(const size_t order, const bool symmetric)
+{
+    const size_t offset = this->size();
+    const size_t length = offset + (symmetric ? ((order * (order + 1)) >> 1) : order * order);
+    // allocate() keeps the previous blocks and only reallocates when the capacity is exceeded
+    Vector<T>::allocate(length, false, true);
+    this->_end = this->_begin + length;
+    this->_rows += order;
+    this->_cols += order;
+    _blockStart.push_back(this->_rows);
+    _blockOffset.push_back(length);
+    _blockSym.push_back(symmetric);
+    return this->_begin + offset;
+}
+
+template <typename T>
+blockDiagMatrix<T> *blockDiagMatrix<T>::addBlock(const size_t order, const bool symmetric)
+{
+    T *block = appendBlock(order, symmetric);
+    const size_t length = this->size();
+    for (T *i = block; i < this->_begin + length; i++)
+        *i = 0;
+    return this;
+}
+
+template <typename T>
+template <typename U>
+blockDiagMatrix<T> *blockDiagMatrix<T>::addBlock(const rowMajorMatrix<U> &block)
+{
+    if (block._rows != block._cols)
+        throw "blockDiagMatrix::addBlock() not a square matrix";
+    T *data = appendBlock(block._rows, false);
+    const size_t N = block.size();
+    for (size_t i = 0; i < N; i++)
+        data[i] = block._begin[i];
+    return this;
+}
+
+template <typename T>
+template <typename U>
+blockDiagMatrix<T> *blockDiagMatrix<T>::addBlock(const symMatrix<U> &block)
+{
+    T *data = appendBlock(block._rows, true);
+    const size_t N = block.size();
+    for (size_t i = 0; i < N; i++)
+        data[i] = block._begin[i];
+    return this;
+}
+
+template <typename T>
+blockDiagMatrix<T> *blockDiagMatrix<T>::hold(const blockDiagMatrix<T> &other)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(blockDiagMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), accounting::bytes(other));
+    this->_rows = other._rows;
+    this->_cols = other._cols;
+    _blockStart.hold(other._blockStart);
+    _blockOffset.hold(other._blockOffset);
+    _blockSym.hold(other._blockSym);
+    Vector<T>::hold(other);
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+blockDiagMatrix<T> *blockDiagMatrix<T>::holdLDL(const blockDiagMatrix<U> &a)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(blockDiagMatrix, holdLDL, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::blockSum(a, 3) / 3 + accounting::blockSum(a, 2), accounting::bytes(a), (accounting::blockSum(a, 2) + accounting::blockSum(a, 1)) / 2 * sizeof(T));
+    const bool inPlace = (const void *)this == (const void *)&a;
+    const size_t blocks = a.blocks();
+    if (inPlace)
+    {
+        for (size_t k = 0; k < blocks; k++)
+            if (!_blockSym[k])
+                throw "blockDiagMatrix::holdLDL() dense blocks can not be factorized in place";
+    }
+    else
+        clear();
+
+    for (size_t b = 0; b < blocks; b++)
+    {
+        const size_t n = a.blockOrder(b);
+        const bool sym = a._blockSym[b];
+        const U *a_block = a._begin + a._blockOffset[b];
+        T *l = inPlace ? this->_begin + _blockOffset[b] : appendBlock(n, true);
+        // same algorithm as ldl_matrix::decompose(), row by row so that it can be done in place
+        for (size_t i = 0; i < n; i++)
+        {
+            T *l_i = l + ((i * (i + 1)) >> 1);
+            const U *a_i = a_block + (sym ? ((i * (i + 1)) >> 1) : i * n);
+            for (size_t j = 0; j < i; j++)
+            {
+                const T *l_j = l + ((j * (j + 1)) >> 1);
+                A sum = a_i[j];
+                for (size_t k = 0; k < j; k++)
+                    sum -= l_i[k] * l_j[k] * l[((k * (k + 1)) >> 1) + k];
+                l_i[j] = sum / l_j[j];
+            }
+            A d = a_i[i];
+            for (size_t k = 0; k < i; k++)
+                d -= l_i[k] * l_i[k] * l[((k * (k + 1)) >> 1) + k];
+            l_i[i] = d;
+        }
+    }
+    return this;
+}
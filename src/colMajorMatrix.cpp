@@ -41,9 +41,11 @@ colMajorMatrix<T>::colMajorMatrix(T *data, const size_t rows, const size_t cols,
 
 ////////////////////////// colMajorMatrix and colMajorMatrix //////////////////////////
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -55,7 +57,7 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const
     {
         for (size_t i = 0; i < this->_rows; i++)
         {
-            T sum = 0;
+            A sum = 0;
             size_t a_index = i;
             for (size_t k = 0; k < a._cols; k++)
             {
@@ -74,6 +76,8 @@ template <typename T>
 template <typename U>
 colMajorMatrix<T> *colMajorMatrix<T>::hold(const rowMajorMatrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), (uint64_t)other.rows() * other.cols() * sizeof(T));
     if (checkSize)
         this->resizeLike(other, false, false);
     size_t index = 0;
@@ -93,6 +97,8 @@ template <typename T>
 template <typename U, typename V>
 colMajorMatrix<T> *colMajorMatrix<T>::holdAdd(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -112,6 +118,8 @@ template <typename T>
 template <typename U, typename V>
 colMajorMatrix<T> *colMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -128,9 +136,11 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -141,7 +151,7 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const
         size_t a_index = 0;
         for (size_t i = 0; i < this->_rows; i++)
         {
-            T sum = 0;
+            A sum = 0;
             size_t b_index = j;
             for (size_t k = 0; k < a._cols; k++)
             {
@@ -161,6 +171,8 @@ template <typename T>
 template <typename U, typename V>
 colMajorMatrix<T> *colMajorMatrix<T>::holdAdd(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -180,6 +192,8 @@ template <typename T>
 template <typename U, typename V>
 colMajorMatrix<T> *colMajorMatrix<T>::holdSub(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -199,6 +213,8 @@ template <typename T>
 template <typename U, typename V>
 colMajorMatrix<T> *colMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -215,9 +231,11 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -227,7 +245,7 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const
     {
         for (size_t i = 0; i < this->_rows; i++)
         {
-            T sum = 0;
+            A sum = 0;
             size_t a_index = i;
             size_t b_index = j;
             for (size_t k = 0; k < a._cols; k++)
@@ -244,9 +262,11 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(colMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -258,7 +278,7 @@ colMajorMatrix<T> *colMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const
         size_t a_index = 0;
         for (size_t i = 0; i < this->_rows; i++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < a._cols; k++)
             {
                 sum += a._begin[a_index + k] * b._begin[b_index + k];
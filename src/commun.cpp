@@ -63,6 +63,7 @@ namespace internal
         size_t current_cap = 0;
         const size_t buffer_size = buffer.size();
         const size_t needed_N = Derived::staticHelper.minMemorySize(shape...);
+        LINEAR_ALGEBRA_TRACE_SCOPE(tmp, get, needed_N, 1);
         for (size_t i = 0; i < buffer_size; i++)
         {
             current_cap = buffer[i]->capacity();
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define CSC_MATRIX_CPP
+#include "cscMatrix.hpp"
+
+template <typename T>
+const cscMatrix<T> cscMatrix<T>::staticHelper;
+
+template <typename T>
+cscMatrix<T> *cscMatrix<T>::swap(cscMatrix<T> &other) noexcept
+{
+    MatrixBase<T>::swap(other);
+    _colPtr.swap(other._colPtr);
+    _rowIndex.swap(other._rowIndex);
+    const size_t tmp = _lastCol;
+    _lastCol = other._lastCol;
+    other._lastCol = tmp;
+    return this;
+}
+
+template <typename T>
+const size_t cscMatrix<T>::find(const size_t row, const size_t col) const noexcept
+{
+    // the rows of a column are sorted, binary search
+    size_t first = _colPtr[col];
+    size_t last = _colPtr[col + 1];
+    while (first < last)
+    {
+        const size_t middle = (first + last) >> 1;
+        const size_t r = _rowIndex[middle];
+        if (r == row)
+            return middle;
+        if (r < row)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return npos;
+}
+
+template <typename T>
+T &cscMatrix<T>::operator()(const size_t row, const size_t col)
+{
+    const size_t index = find(row, col);
+    if (index == npos)
+        throw "cscMatrix::operator() element out of the sparsity structure";
+    return this->_begin[index];
+}
+
+template <typename T>
+const T &cscMatrix<T>::operator()(const size_t row, const size_t col) const
+{
+    const size_t index = find(row, col);
+    return (index == npos) ? internal::_zero<T> : this->_begin[index];
+}
+
+template <typename T>
+cscMatrix<T> *cscMatrix<T>::resize(const size_t rows, const size_t cols, const bool deallocIfPossible, const bool saveData)
+{
+    _lastCol = 0;
+    if (rows == this->_rows && cols == this->_cols && _colPtr.size() == cols + 1 && this->size() == 0)
+        return this;
+    this->_rows = rows;
+    this->_cols = cols;
+    _colPtr.resize(cols + 1, deallocIfPossible, false);
+    _colPtr.fill(0);
+    _rowIndex.resize(0, deallocIfPossible, false);
+    Vector<T>::resize(0, deallocIfPossible, false);
+    return this;
+}
+
+template <typename T>
+cscMatrix<T> *cscMatrix<T>::push_back(const size_t row, const size_t col, const T &value)
+{
+    if (row >= this->_rows || col >= this->_cols)
+        throw "cscMatrix::push_back() out of range";
+    const size_t nnz = this->size();
+    // the columns must be given in increasing order and the rows of a column too
+    if (col < _lastCol || (col == _lastCol && _colPtr[col] != nnz && _rowIndex[nnz - 1] >= row))
+        throw "cscMatrix::push_back() elements must be given in column-major order";
+    Vector<T>::push_back(value);
+    _rowIndex.push_back(row);
+    // the columns skipped since the last value are empty, the pointers of the next columns are left behind
+    for (size_t j = _lastCol + 2; j <= col; j++)
+        _colPtr[j] = nnz;
+    _colPtr[col + 1] = nnz + 1;
+    _lastCol = col;
+    return this;
+}
+
+template <typename T>
+cscMatrix<T> *cscMatrix<T>::hold(const cscMatrix<T> &other)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(cscMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), accounting::bytes(other));
+    this->_rows = other._rows;
+    this->_cols = other._cols;
+    _colPtr.hold(other._colPtr);
+    _lastCol = other._lastCol;
+    _rowIndex.hold(other._rowIndex);
+    Vector<T>::hold(other);
+    return this;
+}
+
+template <typename T>
+template <typename U>
+cscMatrix<T> *cscMatrix<T>::hold(const rowMajorMatrix<U> &dense, const T &threshold)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(cscMatrix, hold, dense.rows(), dense.cols());
+    // the number of stored values is only known on return, the writes are not counted
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(dense), 0);
+    this->_rows = dense._rows;
+    this->_cols = dense._cols;
+    _colPtr.resize(this->_cols + 1, false, false);
+
+    // first pass to know the number of non-zero values
+    size_t nnz = 0;
+    const size_t N = dense.size();
+    for (size_t i = 0; i < N; i++)
+        if (dense._begin[i] > threshold || dense._begin[i] < -threshold)
+            nnz++;
+    _rowIndex.resize(nnz, false, false);
+    Vector<T>::resize(nnz, false, false);
+
+    nnz = 0;
+    for (size_t j = 0; j < this->_cols; j++)
+    {
+        _colPtr[j] = nnz;
+        size_t index = j;
+        for (size_t i = 0; i < this->_rows; i++)
+        {
+            const U value = dense._begin[index];
+            if (value > threshold || value < -threshold)
+            {
+                this->_begin[nnz] = value;
+                _rowIndex[nnz++] = i;
+            }
+            index += this->_cols;
+        }
+    }
+    _colPtr[this->_cols] = nnz;
+    _lastCol = this->_cols ? this->_cols - 1 : 0;
+    return this;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define CSR_MATRIX_CPP
+#include "csrMatrix.hpp"
+
+template <typename T>
+const csrMatrix<T> csrMatrix<T>::staticHelper;
+
+template <typename T>
+csrMatrix<T> *csrMatrix<T>::swap(csrMatrix<T> &other) noexcept
+{
+    MatrixBase<T>::swap(other);
+    _rowPtr.swap(other._rowPtr);
+    _colIndex.swap(other._colIndex);
+    const size_t tmp = _lastRow;
+    _lastRow = other._lastRow;
+    other._lastRow = tmp;
+    return this;
+}
+
+template <typename T>
+const size_t csrMatrix<T>::find(const size_t row, const size_t col) const noexcept
+{
+    // the columns of a row are sorted, binary search
+    size_t first = _rowPtr[row];
+    size_t last = _rowPtr[row + 1];
+    while (first < last)
+    {
+        const size_t middle = (first + last) >> 1;
+        const size_t c = _colIndex[middle];
+        if (c == col)
+            return middle;
+        if (c < col)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return npos;
+}
+
+template <typename T>
+T &csrMatrix<T>::operator()(const size_t row, const size_t col)
+{
+    const size_t index = find(row, col);
+    if (index == npos)
+        throw "csrMatrix::operator() element out of the sparsity structure";
+    return this->_begin[index];
+}
+
+template <typename T>
+const T &csrMatrix<T>::operator()(const size_t row, const size_t col) const
+{
+    const size_t index = find(row, col);
+    return (index == npos) ? internal::_zero<T> : this->_begin[index];
+}
+
+template <typename T>
+csrMatrix<T> *csrMatrix<T>::resize(const size_t rows, const size_t cols, const bool deallocIfPossible, const bool saveData)
+{
+    _lastRow = 0;
+    if (rows == this->_rows && cols == this->_cols && _rowPtr.size() == rows + 1 && this->size() == 0)
+        return this;
+    this->_rows = rows;
+    this->_cols = cols;
+    _rowPtr.resize(rows + 1, deallocIfPossible, false);
+    _rowPtr.fill(0);
+    _colIndex.resize(0, deallocIfPossible, false);
+    Vector<T>::resize(0, deallocIfPossible, false);
+    return this;
+}
+
+template <typename T>
+csrMatrix<T> *csrMatrix<T>::push_back(const size_t row, const size_t col, const T &value)
+{
+    if (row >= this->_rows || col >= this->_cols)
+        throw "csrMatrix::push_back() out of range";
+    const size_t nnz = this->size();
+    // the rows must be given in increasing order and the columns of a row too
+    if (row < _lastRow || (row == _lastRow && _rowPtr[row] != nnz && _colIndex[nnz - 1] >= col))
+        throw "csrMatrix::push_back() elements must be given in row-major order";
+    Vector<T>::push_back(value);
+    _colIndex.push_back(col);
+    // the rows skipped since the last value are empty, the pointers of the next rows are left behind
+    for (size_t i = _lastRow + 2; i <= row; i++)
+        _rowPtr[i] = nnz;
+    _rowPtr[row + 1] = nnz + 1;
+    _lastRow = row;
+    return this;
+}
+
+template <typename T>
+csrMatrix<T> *csrMatrix<T>::hold(const csrMatrix<T> &other)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(csrMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), accounting::bytes(other));
+    this->_rows = other._rows;
+    this->_cols = other._cols;
+    _rowPtr.hold(other._rowPtr);
+    _lastRow = other._lastRow;
+    _colIndex.hold(other._colIndex);
+    Vector<T>::hold(other);
+    return this;
+}
+
+template <typename T>
+template <typename U>
+csrMatrix<T> *csrMatrix<T>::hold(const rowMajorMatrix<U> &dense, const T &threshold)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(csrMatrix, hold, dense.rows(), dense.cols());
+    // the number of stored values is only known on return, the writes are not counted
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(dense), 0);
+    this->_rows = dense._rows;
+    this->_cols = dense._cols;
+    _rowPtr.resize(this->_rows + 1, false, false);
+
+    // first pass to know the number of non-zero values
+    size_t nnz = 0;
+    const size_t N = dense.size();
+    for (size_t i = 0; i < N; i++)
+        if (dense._begin[i] > threshold || dense._begin[i] < -threshold)
+            nnz++;
+    _colIndex.resize(nnz, false, false);
+    Vector<T>::resize(nnz, false, false);
+
+    nnz = 0;
+    size_t index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        _rowPtr[i] = nnz;
+        for (size_t j = 0; j < this->_cols; j++)
+        {
+            const U value = dense._begin[index++];
+            if (value > threshold || value < -threshold)
+            {
+                this->_begin[nnz] = value;
+                _colIndex[nnz++] = j;
+            }
+        }
+    }
+    _rowPtr[this->_rows] = nnz;
+    _lastRow = this->_rows ? this->_rows - 1 : 0;
+    return this;
+}
@@ -44,4 +44,14 @@ T diagMatrix<T>::det() const
     for (size_t i = 0; i < this->_cols; i++)
         res *= this->_begin[i];
     return res;
+}
+
+template <typename T>
+template <typename A>
+A diagMatrix<T>::trace() const
+{
+    const size_t n = this->_rows < this->_cols ? this->_rows : this->_cols;
+    LINEAR_ALGEBRA_TRACE_SCOPE(diagMatrix, reduce, n, n);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)n, (uint64_t)n * sizeof(T), 0);
+    return internal::reduction::sum<A>(this->_begin, n);
 }
\ No newline at end of file
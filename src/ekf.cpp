@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define EKF_CPP
+#include "ekf.hpp"
+#include "threadPool.hpp"
+
+template <typename T, size_t N, size_t M>
+ekf<T, N, M>::ekf(const transition &f, const transitionJacobian &df, const measurement &h, const measurementJacobian &dh)
+    : f(f), df(df), h(h), dh(dh), F(N, N), H(M, N), FP(N, N), HP(M, N), W(M, N), K(N, M),
+      Ft(F.begin(), N, N), Ht(H.begin(), N, M), Wt(W.begin(), N, M), S(M), fx(N), hx(M), y(M), x(N), P(N), Q(N), R(M)
+{
+    x.fill(0);
+    P.fill(0);
+    Q.fill(0);
+    R.fill(0);
+    F.fill(0);
+    H.fill(0);
+    // the kernels run on the thread pool : it is created now rather than during the first step
+    internal::threadPool::global();
+}
+
+template <typename T, size_t N, size_t M>
+ekf<T, N, M> *ekf<T, N, M>::predict(const Vector<T> &u)
+{
+    df(F, x, u);
+    f(fx, x, u);
+    x.hold(fx, false);
+    FP.holdMul(F, P, false);
+    P.holdMul(FP, Ft, false);
+    P.holdAdd(P, Q, false);
+    return this;
+}
+
+template <typename T, size_t N, size_t M>
+ekf<T, N, M> *ekf<T, N, M>::update(const Vector<T> &z)
+{
+    if (z.size() != M)
+        throw "ekf::update() wrong measurement size";
+    dh(H, x);
+    h(hx, x);
+    y.holdSub(z, hx, false);
+    HP.holdMul(H, P, false);
+    S.holdMul(HP, Ht, false);
+    S.holdAdd(S, R, false);
+    S.decompose();
+    // W = S^-1*H*P = K^T
+    W.holdSolveLDL(S, HP, false);
+    K.hold(Wt, false);
+    x.addMul(K, y, false);
+    P.subMul(K, HP, false, false);
+    return this;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define EXPM_CPP
+#include "expm.hpp"
+
+template <typename T>
+expm<T>::expm(const size_t order) : X(order, order), N(order, order), D(order, order), W(order, order)
+{
+}
+
+template <typename T>
+rowMajorMatrix<T> *expm<T>::identity(rowMajorMatrix<T> &m) const
+{
+    m.fill(0);
+    for (size_t i = 0; i < m.rows(); i++)
+        m.begin()[i * m.cols() + i] = 1;
+    return &m;
+}
+
+template <typename T>
+rowMajorMatrix<T> *expm<T>::solve(rowMajorMatrix<T> &out)
+{
+    const size_t n = order();
+    // out = D \ N : elimination of D with the n columns of N carried along, then back substitution
+    const uint64_t n64 = n;
+    LINEAR_ALGEBRA_TRACE_SCOPE(expm, holdDiv, n, n);
+    LINEAR_ALGEBRA_ACCOUNT((n64 - 1) * n64 * (2 * n64 - 1) / 3 + (2 * n64 + 1) * (n64 - 1) * n64 / 2 + n64 * n64 * (n64 - 1) + n64 * n64 + n64, 2 * n64 * n64 * sizeof(T), n64 * n64 * sizeof(T));
+    T *d = D.begin();
+    T *r = N.begin();
+    for (size_t k = 0; k < n; k++)
+    {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; i++)
+            if (internal::reduction::abs(d[i * n + k]) > internal::reduction::abs(d[pivot * n + k]))
+                pivot = i;
+        if (d[pivot * n + k] == T(0))
+            throw "expm::compute() singular denominator";
+        if (pivot != k)
+            for (size_t j = 0; j < n; j++)
+            {
+                T t = d[k * n + j];
+                d[k * n + j] = d[pivot * n + j];
+                d[pivot * n + j] = t;
+                t = r[k * n + j];
+                r[k * n + j] = r[pivot * n + j];
+                r[pivot * n + j] = t;
+            }
+        for (size_t i = k + 1; i < n; i++)
+        {
+            const T l = d[i * n + k] / d[k * n + k];
+            if (l == T(0))
+                continue;
+            for (size_t j = k + 1; j < n; j++)
+                d[i * n + j] -= l * d[k * n + j];
+            for (size_t j = 0; j < n; j++)
+                r[i * n + j] -= l * r[k * n + j];
+        }
+    }
+    // back substitution, all the columns of N at once
+    T *x = out.begin();
+    for (size_t i = n; i-- > 0;)
+    {
+        for (size_t j = 0; j < n; j++)
+            x[i * n + j] = r[i * n + j];
+        for (size_t k = i + 1; k < n; k++)
+            for (size_t j = 0; j < n; j++)
+                x[i * n + j] -= d[i * n + k] * x[k * n + j];
+        const T inverse = T(1) / d[i * n + i];
+        for (size_t j = 0; j < n; j++)
+            x[i * n + j] *= inverse;
+    }
+    return &out;
+}
+
+template <typename T>
+template <typename A>
+rowMajorMatrix<T> *expm<T>::compute(rowMajorMatrix<T> &out, const rowMajorMatrix<T> &a, const method m, const size_t taylorOrder)
+{
+    const size_t n = order();
+    if (a.rows() != n || a.cols() != n)
+        throw "expm::compute() wrong size";
+    if (out.begin() && out.begin() < a.begin() + a.size() && a.begin() < out.begin() + out.size())
+        throw "expm::compute() out overlaps a";
+    out.resize(n, n, false, false);
+    if (m == method::taylor)
+    {
+        // I + A*(I + A/2*(I + A/3*(...)))
+        identity(out);
+        for (size_t k = taylorOrder; k >= 1; k--)
+        {
+            W.template holdMul<T, T, A>(a, out, false, false);
+            const T inverse = T(1) / T(k);
+            for (size_t i = 0; i < n * n; i++)
+                out.begin()[i] = W.begin()[i] * inverse;
+            for (size_t i = 0; i < n; i++)
+                out.begin()[i * n + i] += 1;
+        }
+        return &out;
+    }
+    // W = A / 2^s with a norm at most 1/2
+    A norm = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        A row = 0;
+        for (size_t j = 0; j < n; j++)
+            row += internal::reduction::abs(a.begin()[i * n + j]);
+        norm = row > norm ? row : norm;
+    }
+    size_t s = 0;
+    T scale = 1;
+    while (norm * scale > A(0.5))
+    {
+        scale /= 2;
+        s++;
+    }
+    for (size_t i = 0; i < n * n; i++)
+        W.begin()[i] = a.begin()[i] * scale;
+    // N = sum of c_k * W^k, D = sum of (-1)^k * c_k * W^k
+    const size_t q = 6;
+    T c = 1;
+    identity(X);
+    identity(N);
+    identity(D);
+    for (size_t k = 1; k <= q; k++)
+    {
+        c = c * T(q - k + 1) / T(k * (2 * q - k + 1));
+        out.template holdMul<T, T, A>(W, X, false, false);
+        X.hold(out, false);
+        const T signedC = k % 2 ? -c : c;
+        for (size_t i = 0; i < n * n; i++)
+        {
+            N.begin()[i] += c * X.begin()[i];
+            D.begin()[i] += signedC * X.begin()[i];
+        }
+    }
+    solve(out);
+    for (size_t k = 0; k < s; k++)
+    {
+        X.template holdMul<T, T, A>(out, out, false, false);
+        out.hold(X, false);
+    }
+    return &out;
+}
+
+template <typename T>
+template <typename A>
+vanLoan<T> *vanLoan<T>::discretize(rowMajorMatrix<T> &F, symMatrix<T> &Qd, const rowMajorMatrix<T> &a, const symMatrix<T> &q, const T dt, const typename expm<T>::method m, const size_t taylorOrder)
+{
+    const size_t n = a.rows();
+    if (a.cols() != n || q.rows() != n || 2 * n != exponential.order())
+        throw "vanLoan::discretize() wrong size";
+    const size_t n2 = 2 * n;
+    // M = [-A, Q; 0, A^T] * dt
+    M.fill(0);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+        {
+            M.begin()[i * n2 + j] = -a.begin()[i * n + j] * dt;
+            M.begin()[i * n2 + n + j] = q.begin()[i >= j ? ((i * (i + 1)) >> 1) + j : ((j * (j + 1)) >> 1) + i] * dt;
+            M.begin()[(n + i) * n2 + n + j] = a.begin()[j * n + i] * dt;
+        }
+    exponential.template compute<A>(E, M, m, taylorOrder);
+    // F = (bottom right block)^T, Qd = F * (top right block)
+    F.resize(n, n, false, false);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            F.begin()[i * n + j] = E.begin()[(n + j) * n2 + n + i];
+    Qd.resize(n, n, false, false);
+    T *qd = Qd.begin();
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++)
+        {
+            A sum = 0;
+            for (size_t k = 0; k < n; k++)
+                sum += F.begin()[i * n + k] * E.begin()[k * n2 + n + j];
+            *qd++ = sum;
+        }
+    return this;
+}
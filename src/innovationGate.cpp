@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define INNOVATION_GATE_CPP
+#include "innovationGate.hpp"
+
+template <typename T>
+innovationGate<T>::innovationGate(const size_t order, const size_t capacity, const T probability) : S(order), Y(order, capacity), _threshold(chiSquareQuantile(order, probability))
+{
+}
+
+template <typename T>
+double innovationGate<T>::gammaP(const double a, const double x)
+{
+    if (x <= 0)
+        return 0;
+    const double prefix = exp(a * log(x) - x - lgamma(a));
+    if (x < a + 1)
+    {
+        // series
+        double term = 1 / a, sum = term;
+        for (size_t n = 1; n < 1000 && fabs(term) > fabs(sum) * 1e-16; n++)
+        {
+            term *= x / (a + n);
+            sum += term;
+        }
+        return sum * prefix;
+    }
+    // continued fraction of Q(a, x), modified Lentz
+    const double tiny = 1e-300;
+    double b = x + 1 - a, c = 1 / tiny, d = 1 / b, h = d;
+    for (size_t n = 1; n < 1000; n++)
+    {
+        const double an = -(double)n * (n - a);
+        b += 2;
+        d = an * d + b;
+        d = fabs(d) < tiny ? tiny : d;
+        c = b + an / c;
+        c = fabs(c) < tiny ? tiny : c;
+        d = 1 / d;
+        const double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1) < 1e-16)
+            break;
+    }
+    return 1 - prefix * h;
+}
+
+template <typename T>
+T innovationGate<T>::chiSquareQuantile(const size_t dof, const T probability)
+{
+    if (dof == 0 || !(probability > 0) || !(probability < 1))
+        throw "innovationGate::chiSquareQuantile() needs dof > 0 and 0 < probability < 1";
+    // P(chi2 <= x) = P(dof / 2, x / 2), bracketed then bisected
+    const double a = 0.5 * dof, p = probability;
+    double low = 0, high = dof;
+    while (gammaP(a, 0.5 * high) < p)
+    {
+        low = high;
+        high *= 2;
+    }
+    for (size_t i = 0; i < 200 && high - low > 1e-15 * high; i++)
+    {
+        const double middle = 0.5 * (low + high);
+        if (gammaP(a, 0.5 * middle) < p)
+            low = middle;
+        else
+            high = middle;
+    }
+    return T(0.5 * (low + high));
+}
+
+template <typename T>
+innovationGate<T> *innovationGate<T>::setCovariance(const symMatrix<T> &s)
+{
+    if (s.rows() != order())
+        throw "innovationGate::setCovariance() wrong size";
+    S.hold(s, false);
+    S.decompose();
+    return setFactor(S);
+}
+
+template <typename T>
+innovationGate<T> *innovationGate<T>::setFactor(const ldl_matrix<T> &s)
+{
+    const size_t m = order();
+    if (s.rows() != m)
+        throw "innovationGate::setFactor() wrong size";
+    if (&s != &S)
+    {
+        S.L.hold(s.L, false);
+        S.D.hold(s.D, false);
+    }
+    T logDeterminant = 0;
+    for (size_t i = 0; i < m; i++)
+    {
+        if (!(S.D.begin()[i] > 0))
+            throw "innovationGate::setFactor() S is not positive definite";
+        logDeterminant += log(S.D.begin()[i]);
+    }
+    _logDeterminant = logDeterminant;
+    return this;
+}
+
+template <typename T>
+void innovationGate<T>::solve(Vector<T> &d2, const colMajorMatrix<T> &innovations)
+{
+    const size_t m = order(), K = innovations.cols();
+    LINEAR_ALGEBRA_TRACE_SCOPE(innovationGate, holdSolveLDL, m, K);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)m * (m - 1) * K + 3 * (uint64_t)m * K + m, ((uint64_t)m * K + accounting::packed(m - 1) + m) * sizeof(T), ((uint64_t)m * K + K) * sizeof(T));
+    if (innovations.rows() != m)
+        throw "innovationGate::mahalanobis() wrong size";
+    Y.resize(m, K, false, false);
+    d2.resize(K, false, false);
+    d2.fill(0);
+    const T *nu = innovations.begin();
+    const T *L = S.L.begin();
+    const T *D = S.D.begin();
+    T *y = Y.begin();
+    T *d = d2.begin();
+    // row i of Y for every candidate : Y(i, :) = nu(i, :) - sum of L(i, j) * Y(j, :), then d2 += Y(i, :)^2 / D(i)
+    for (size_t i = 0; i < m; i++)
+    {
+        T *yi = y + i * K;
+        for (size_t k = 0; k < K; k++)
+            yi[k] = nu[k * m + i];
+        const T *li = L + (((i - 1) * i) >> 1);
+        for (size_t j = 0; j < i; j++)
+        {
+            const T l = li[j];
+            const T *yj = y + j * K;
+            for (size_t k = 0; k < K; k++)
+                yi[k] -= l * yj[k];
+        }
+        const T inverse = T(1) / D[i];
+        for (size_t k = 0; k < K; k++)
+            d[k] += yi[k] * yi[k] * inverse;
+    }
+}
+
+template <typename T>
+Vector<T> *innovationGate<T>::mahalanobis(Vector<T> &d2, const colMajorMatrix<T> &innovations)
+{
+    solve(d2, innovations);
+    return &d2;
+}
+
+template <typename T>
+Vector<T> *innovationGate<T>::logLikelihood(Vector<T> &out, const colMajorMatrix<T> &innovations)
+{
+    solve(out, innovations);
+    const T constant = _logDeterminant + T(order()) * T(1.8378770664093454836); // log(2 * pi)
+    for (size_t k = 0; k < out.size(); k++)
+        out[k] = T(-0.5) * (out[k] + constant);
+    return &out;
+}
+
+template <typename T>
+size_t innovationGate<T>::gate(Vector<size_t> &accepted, Vector<T> &d2, const colMajorMatrix<T> &innovations)
+{
+    solve(d2, innovations);
+    accepted.resize(d2.size(), false, false);
+    size_t count = 0;
+    for (size_t k = 0; k < d2.size(); k++)
+        if (d2[k] <= _threshold)
+            accepted[count++] = k;
+    return count;
+}
@@ -19,24 +19,34 @@
 
 #define LDL_MATRIX_CPP
 #include "ldl_Matrix.hpp"
+#include "threadPool.hpp"
 
 template <typename T>
+template <typename A>
 ldl_matrix<T> *ldl_matrix<T>::decompose()
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(ldl_matrix, decompose, this->rows(), this->cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)this->rows() * this->rows() * this->rows() / 3 + (uint64_t)this->rows() * this->rows(), accounting::bytes(*this), accounting::bytes(this->L) + accounting::bytes(this->D));
     for (size_t j = 0; j < this->_rows; j++)
     {
-        D[j] = this->_begin[(j * (j + 1) >> 1) + j];
         const size_t l_index = ((j - 1) * j) >> 1;
+        A d = this->_begin[(j * (j + 1) >> 1) + j];
         for (size_t k = 0; k < j; k++)
-            D[j] -= L[l_index + k] * L[l_index + k] * D[k];
-        for(size_t i = j + 1; i < this->_rows; i++)
+            d -= L[l_index + k] * L[l_index + k] * D[k];
+        D[j] = d;
+        // the rows below j only read the columns before j : they are split over the threads
+        const size_t below = this->_rows - j - 1;
+        internal::threadPool::global().forBlocks(below, 1, below * j, [&](const size_t rowBegin, const size_t rowEnd)
         {
-            const size_t l_index2 = ((i - 1) * i) >> 1;
-            L[l_index2 + j] = this->_begin[(i * (i + 1) >> 1) + j];
-            for (size_t k = 0; k < j; k++)
-                L[l_index2 + j] -= L[l_index + k] * L[l_index2 + k] * D[k];
-            L[l_index2 + j] /= D[j];
-        }
+            for(size_t i = j + 1 + rowBegin; i < j + 1 + rowEnd; i++)
+            {
+                const size_t l_index2 = ((i - 1) * i) >> 1;
+                A sum = this->_begin[(i * (i + 1) >> 1) + j];
+                for (size_t k = 0; k < j; k++)
+                    sum -= L[l_index + k] * L[l_index2 + k] * D[k];
+                L[l_index2 + j] = sum / D[j];
+            }
+        });
     }
     return referT();
 }
\ No newline at end of file
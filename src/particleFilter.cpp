@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define PARTICLE_FILTER_CPP
+#include "particleFilter.hpp"
+
+template <typename T>
+particleFilter<T>::particleFilter(const size_t count, const size_t dims, const propagation &propagate, const likelihood &weigh)
+    : propagate(propagate), weigh(weigh), _logWeights(count), _weights(count), cumulative(count), logLikelihood(count), indices(count)
+{
+    if (count == 0)
+        throw "particleFilter::particleFilter() no particle";
+    buffers[0].resize(count, dims);
+    buffers[1].resize(count, dims);
+    buffers[0].fill(0);
+    buffers[1].fill(0);
+    _logWeights.fill(-log(T(count)));
+    _weights.fill(T(1) / count);
+    // the propagation may run on the thread pool : it is created now rather than during the first step
+    internal::threadPool::global();
+}
+
+template <typename T>
+particleFilter<T> *particleFilter<T>::predict(const Vector<T> &u, const bool parallel)
+{
+    colMajorMatrix<T> &states = buffers[current];
+    if (parallel)
+        parallel_for(0, count(), [&](const size_t begin, const size_t end) { propagate(states, begin, end, u); }, internal::threadPool::rowAlign(sizeof(T)));
+    else
+        propagate(states, 0, count(), u);
+    return this;
+}
+
+template <typename T>
+particleFilter<T> *particleFilter<T>::update(const Vector<T> &z, const bool parallel)
+{
+    const colMajorMatrix<T> &states = buffers[current];
+    if (parallel)
+        parallel_for(0, count(), [&](const size_t begin, const size_t end) { weigh(logLikelihood, states, begin, end, z); }, internal::threadPool::rowAlign(sizeof(T)));
+    else
+        weigh(logLikelihood, states, 0, count(), z);
+    _logWeights.holdAdd(_logWeights, logLikelihood, false);
+    return normalize();
+}
+
+template <typename T>
+particleFilter<T> *particleFilter<T>::normalize(const fastMath::accuracy accuracy)
+{
+    const T max = _logWeights.maximum();
+    // -inf when no particle explains the measurement, the weights would all be NaN
+    if (!(max > -INFINITY && max < INFINITY))
+        throw "particleFilter::normalize() no finite log weight";
+    _weights.holdSub(_logWeights, max, false);
+    _weights.holdExp(_weights, accuracy, false);
+    const T sum = _weights.sum();
+    if (!(sum > 0 && sum < INFINITY))
+        throw "particleFilter::normalize() log weights are not finite";
+    _weights.holdMul(_weights, T(1) / sum, false);
+    _logWeights.holdSub(_logWeights, T(max + log(sum)), false);
+    return this;
+}
+
+template <typename T>
+T particleFilter<T>::effectiveSampleSize() const
+{
+    return T(1) / _weights.norm2Squared();
+}
+
+template <typename T>
+template <typename A>
+Vector<T> *particleFilter<T>::mean(Vector<T> &out) const
+{
+    const colMajorMatrix<T> &states = buffers[current];
+    out.resize(dims(), false, false);
+    for (size_t j = 0; j < dims(); j++)
+    {
+        const T *column = states.begin() + j * count();
+        A sum = 0;
+        for (size_t i = 0; i < count(); i++)
+            sum += _weights[i] * column[i];
+        out[j] = sum;
+    }
+    return &out;
+}
+
+template <typename T>
+particleFilter<T> *particleFilter<T>::gather()
+{
+    const colMajorMatrix<T> &from = buffers[current];
+    colMajorMatrix<T> &to = buffers[1 - current];
+    const size_t n = count();
+    for (size_t j = 0; j < dims(); j++)
+    {
+        const T *source = from.begin() + j * n;
+        T *destination = to.begin() + j * n;
+        for (size_t i = 0; i < n; i++)
+            destination[i] = source[indices[i]];
+    }
+    current = 1 - current;
+    _logWeights.fill(-log(T(n)));
+    _weights.fill(T(1) / n);
+    return this;
+}
+
+template <typename T>
+particleFilter<T> *particleFilter<T>::resampleSystematic(const T u)
+{
+    const size_t n = count();
+    cumulative.holdCumSum(_weights, false);
+    // the targets are increasing : one pass over the prefix sums, the last one taken if rounding left it below 1
+    const T step = T(1) / n;
+    size_t j = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const T target = (u + i) * step;
+        while (j + 1 < n && cumulative[j] <= target)
+            j++;
+        indices[i] = j;
+    }
+    return gather();
+}
+
+template <typename T>
+template <typename G>
+particleFilter<T> *particleFilter<T>::resampleStratified(G &uniform)
+{
+    const size_t n = count();
+    cumulative.holdCumSum(_weights, false);
+    const T step = T(1) / n;
+    size_t j = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const T target = (i + T(uniform())) * step;
+        while (j + 1 < n && cumulative[j] <= target)
+            j++;
+        indices[i] = j;
+    }
+    return gather();
+}
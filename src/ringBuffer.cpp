@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define RING_BUFFER_CPP
+#include "ringBuffer.hpp"
+
+template <typename T>
+void ringBuffer<T>::view(Vector<T> &v, T *data, const size_t n) noexcept
+{
+    if (!v.shared())
+    {
+        Vector<T> owned;
+        owned.swap(v);
+    }
+    v.refer(data, n);
+}
+
+template <typename T>
+bool ringBuffer<T>::push(const T &value) noexcept
+{
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (distance(_tail.load(std::memory_order_acquire), head) == capacity())
+        return false;
+    _data._begin[index(head)] = value;
+    _head.store(next(head), std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool ringBuffer<T>::pop(T &value) noexcept
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+        return false;
+    value = _data._begin[index(tail)];
+    _tail.store(next(tail), std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+ringBuffer<T> *ringBuffer<T>::discard(const size_t n) noexcept
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    const size_t available = distance(tail, _head.load(std::memory_order_acquire));
+    size_t position = tail + (n < available ? n : available);
+    if (position >= 2 * capacity())
+        position -= 2 * capacity();
+    _tail.store(position, std::memory_order_release);
+    return this;
+}
+
+template <typename T>
+ringBuffer<T> *ringBuffer<T>::slide(const T &value) noexcept
+{
+    if (capacity() == 0)
+        return this;
+    if (full())
+        discard(1);
+    push(value);
+    return this;
+}
+
+template <typename T>
+const T &ringBuffer<T>::operator[](const size_t i) const noexcept
+{
+    size_t position = _tail.load(std::memory_order_acquire) + i;
+    if (position >= 2 * capacity())
+        position -= 2 * capacity();
+    return _data._begin[index(position)];
+}
+
+template <typename T>
+const ringBuffer<T> *ringBuffer<T>::views(Vector<T> &first, Vector<T> &second) const noexcept
+{
+    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t n = distance(tail, _head.load(std::memory_order_acquire));
+    const size_t begin = index(tail);
+    const size_t firstSize = n < capacity() - begin ? n : capacity() - begin;
+    view(first, _data._begin + begin, firstSize);
+    view(second, _data._begin, n - firstSize);
+    return this;
+}
+
+template <typename T>
+ringBuffer<T> *ringBuffer<T>::linearize(Vector<T> &view) noexcept
+{
+    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t head = _head.load(std::memory_order_acquire);
+    const size_t n = distance(tail, head);
+    const size_t begin = index(tail);
+    if (begin + n > capacity())
+    {
+        // rotation by 3 reversals, the oldest value goes to the front of the storage
+        T *data = _data._begin;
+        const size_t N = capacity();
+        for (size_t i = 0, j = begin - 1; i < j; i++, j--)
+            internal::swap(data[i], data[j]);
+        for (size_t i = begin, j = N - 1; i < j; i++, j--)
+            internal::swap(data[i], data[j]);
+        for (size_t i = 0, j = N - 1; i < j; i++, j--)
+            internal::swap(data[i], data[j]);
+        _tail.store(0, std::memory_order_release);
+        _head.store(n, std::memory_order_release);
+        ringBuffer<T>::view(view, data, n);
+        return this;
+    }
+    ringBuffer<T>::view(view, _data._begin + begin, n);
+    return this;
+}
+
+template <typename T>
+Vector<T> *ringBuffer<T>::copyTo(Vector<T> &holder) const
+{
+    Vector<T> first, second;
+    views(first, second);
+    holder.resize(first.size() + second.size(), false, false);
+    memcpy(holder._begin, first._begin, first.size() * sizeof(T));
+    memcpy(holder._begin + first.size(), second._begin, second.size() * sizeof(T));
+    return &holder;
+}
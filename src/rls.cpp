@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define RLS_CPP
+#include "rls.hpp"
+
+template <typename T, size_t N, size_t B>
+rls<T, N, B>::rls(const T lambda, const T initialCovariance)
+    : g(N), k(N), initial(initialCovariance), PhiP(B, N), W(B, N), K(N, B), Wt(W.begin(), N, B), S(B), errors(B), theta(N), P(N), lambda(lambda)
+{
+    theta.fill(0);
+    g.fill(0);
+    k.fill(0);
+    reset(initialCovariance);
+}
+
+template <typename T, size_t N, size_t B>
+rls<T, N, B> *rls<T, N, B>::reset(const T initialCovariance)
+{
+    P.fill(0);
+    for (size_t i = 0; i < N; i++)
+        P.begin()[((i * (i + 1)) >> 1) + i] = initialCovariance;
+    return this;
+}
+
+template <typename T, size_t N, size_t B>
+rls<T, N, B> *rls<T, N, B>::checkTrace()
+{
+    if (maxTrace > 0 && P.trace() > maxTrace)
+        reset();
+    return this;
+}
+
+template <typename T, size_t N, size_t B>
+template <typename A>
+T rls<T, N, B>::predict(const Vector<T> &phi) const
+{
+    if (phi.size() != N)
+        throw "rls::predict() wrong regressor size";
+    A sum = 0;
+    for (size_t i = 0; i < N; i++)
+        sum += phi.begin()[i] * theta.begin()[i];
+    return sum;
+}
+
+template <typename T, size_t N, size_t B>
+template <typename A>
+rls<T, N, B> *rls<T, N, B>::update(const Vector<T> &phi, const T y)
+{
+    if (phi.size() != N)
+        throw "rls::update() wrong regressor size";
+    g.holdMul(P, phi, false);
+    A denominator = lambda;
+    for (size_t i = 0; i < N; i++)
+        denominator += phi.begin()[i] * g[i];
+    e = y - predict<A>(phi);
+    k.holdMul(g, T(1 / denominator), false);
+    for (size_t i = 0; i < N; i++)
+        theta[i] += k[i] * e;
+    // P = (P - g*g^T / denominator) / lambda
+    P.holdAddOuter(T(1 / lambda), P, T(-1 / (lambda * denominator)), g, false);
+    return checkTrace();
+}
+
+template <typename T, size_t N, size_t B>
+rls<T, N, B> *rls<T, N, B>::update(const rowMajorMatrix<T> &Phi, const Vector<T> &y)
+{
+    if (Phi.rows() != B || Phi.cols() != N || y.size() != B)
+        throw "rls::update() wrong block size";
+    // B forgettings of the prior, sample i weighted by lambda^(B-1-i) : P = (lambda^B * P^-1 + Phi^T*diag(weights)*Phi)^-1, through Woodbury
+    T forget = 1;
+    for (size_t i = 0; i < B; i++)
+        forget *= lambda;
+    P.holdMul(P, T(1 / forget), false);
+    PhiP.holdMul(Phi, P, false);
+    const colMajorMatrix<T> PhiT(Phi.begin(), N, B);
+    S.holdMul(PhiP, PhiT, false);
+    T inverseWeight = 1;
+    for (size_t i = B; i-- > 0;)
+    {
+        S.begin()[((i * (i + 1)) >> 1) + i] += inverseWeight;
+        inverseWeight /= lambda;
+    }
+    errors.holdMul(Phi, theta, false);
+    errors.holdSub(y, errors, false);
+    S.decompose();
+    // W = S^-1*Phi*P = K^T
+    W.holdSolveLDL(S, PhiP, false);
+    K.hold(Wt, false);
+    theta.addMul(K, errors, false);
+    P.subMul(K, PhiP, false, false);
+    e = errors[B - 1];
+    return checkTrace();
+}
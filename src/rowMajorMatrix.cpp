@@ -19,6 +19,7 @@
 
 #define ROW_MAJOR_MATRIX_CPP
 #include "rowMajorMatrix.hpp"
+#include "threadPool.hpp"
 
 template <typename T>
 const rowMajorMatrix<T> rowMajorMatrix<T>::staticHelper;
@@ -41,27 +42,32 @@ rowMajorMatrix<T>::rowMajorMatrix(T *data, const size_t rows, const size_t cols,
 
 ////////////////////////// rowMajorMatrix and rowMajorMatrix //////////////////////////
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
         MatrixBase<T>::checkOverlap(a, b);
     // optimized on ESP32
-    size_t index = 0;
-    size_t a_index = 0;
-    for (size_t i = 0; i < this->_rows; i++)
+    internal::threadPool::global().forBlocks(this->_rows, internal::threadPool::rowAlign(this->_cols * sizeof(T)), this->_rows * this->_cols * a._cols, [&](const size_t rowBegin, const size_t rowEnd)
     {
-        for (size_t j = 0; j < this->_cols; j++)
+        size_t index = rowBegin * this->_cols;
+        size_t a_index = rowBegin * a._cols;
+        for (size_t i = rowBegin; i < rowEnd; i++)
         {
-            T sum = 0;
-            for (size_t k = 0; k < a._cols; k++)
-                sum += a._begin[a_index + k] * b._begin[k*b._cols+j];
-            this->_begin[index++] = sum;
+            for (size_t j = 0; j < this->_cols; j++)
+            {
+                A sum = 0;
+                for (size_t k = 0; k < a._cols; k++)
+                    sum += a._begin[a_index + k] * b._begin[k*b._cols+j];
+                this->_begin[index++] = sum;
+            }
+            a_index += a._cols;
         }
-        a_index += a._cols;
-    }
+    });
     return this;
 }
 
@@ -70,6 +76,8 @@ template <typename T>
 template <typename U>
 rowMajorMatrix<T> *rowMajorMatrix<T>::hold(const colMajorMatrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), (uint64_t)other.rows() * other.cols() * sizeof(T));
     if (checkSize)
         this->resizeLike(other, false, false);
     size_t index = 0;
@@ -89,6 +97,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdAdd(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -108,6 +118,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -124,30 +136,35 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const colMajorMatrix<U> &a, const
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
         MatrixBase<T>::checkOverlap(a, b);
-    size_t index = 0;
-    for (size_t i = 0; i < this->_rows; i++)
+    internal::threadPool::global().forBlocks(this->_rows, internal::threadPool::rowAlign(this->_cols * sizeof(T)), this->_rows * this->_cols * a._cols, [&](const size_t rowBegin, const size_t rowEnd)
     {
-        size_t b_index = 0;
-        for (size_t j = 0; j < this->_cols; j++)
+        size_t index = rowBegin * this->_cols;
+        for (size_t i = rowBegin; i < rowEnd; i++)
         {
-            T sum = 0;
-            size_t a_index = i;
-            for (size_t k = 0; k < a._cols; k++)
+            size_t b_index = 0;
+            for (size_t j = 0; j < this->_cols; j++)
             {
-                sum += a._begin[a_index] * b._begin[b_index + k];
-                a_index += a._rows;
+                A sum = 0;
+                size_t a_index = i;
+                for (size_t k = 0; k < a._cols; k++)
+                {
+                    sum += a._begin[a_index] * b._begin[b_index + k];
+                    a_index += a._rows;
+                }
+                this->_begin[index++] = sum;
+                b_index += b._rows;
             }
-            this->_begin[index++] = sum;
-            b_index += b._rows;
         }
-    }
+    });
     return this;
 }
 
@@ -156,6 +173,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdAdd(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
     {
         if (!a.isAdditionCompatible(b))
@@ -179,6 +198,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -198,6 +219,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -214,59 +237,69 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const colMajorMatrix<U> &a, const
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
         MatrixBase<T>::checkOverlap(a, b);
-    size_t index = 0;
-    size_t a_index = 0;
-    for (size_t i = 0; i < this->_rows; i++)
+    internal::threadPool::global().forBlocks(this->_rows, internal::threadPool::rowAlign(this->_cols * sizeof(T)), this->_rows * this->_cols * a._cols, [&](const size_t rowBegin, const size_t rowEnd)
     {
-        size_t b_index = 0;
-        for (size_t j = 0; j < this->_cols; j++)
+        size_t index = rowBegin * this->_cols;
+        size_t a_index = rowBegin * a._cols;
+        for (size_t i = rowBegin; i < rowEnd; i++)
         {
-            T sum = 0;
-            for (size_t k = 0; k < a._cols; k++)
+            size_t b_index = 0;
+            for (size_t j = 0; j < this->_cols; j++)
             {
-                sum += a._begin[a_index+k] * b._begin[b_index + k];
+                A sum = 0;
+                for (size_t k = 0; k < a._cols; k++)
+                {
+                    sum += a._begin[a_index+k] * b._begin[b_index + k];
+                }
+                this->_begin[index++] = sum;
+                b_index += b._rows;
             }
-            this->_begin[index++] = sum;
-            b_index += b._rows;
+            a_index += a._cols;
         }
-        a_index += a._rows;
-    }
+    });
 
     return this;
 }
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
         MatrixBase<T>::checkOverlap(a, b);
-    size_t index = 0;
-    for (size_t i = 0; i < this->_rows; i++)
+    internal::threadPool::global().forBlocks(this->_rows, internal::threadPool::rowAlign(this->_cols * sizeof(T)), this->_rows * this->_cols * a._cols, [&](const size_t rowBegin, const size_t rowEnd)
     {
-        for (size_t j = 0; j < this->_cols; j++)
+        size_t index = rowBegin * this->_cols;
+        for (size_t i = rowBegin; i < rowEnd; i++)
         {
-            T sum = 0;
-            size_t a_index = i;
-            size_t b_index = j;
-            for (size_t k = 0; k < a._cols; k++)
+            for (size_t j = 0; j < this->_cols; j++)
             {
-                sum += a._begin[a_index] * b._begin[b_index];
-                a_index += a._rows;
-                b_index += b._cols;
+                A sum = 0;
+                size_t a_index = i;
+                size_t b_index = j;
+                for (size_t k = 0; k < a._cols; k++)
+                {
+                    sum += a._begin[a_index] * b._begin[b_index];
+                    a_index += a._rows;
+                    b_index += b._cols;
+                }
+                this->_begin[index++] = sum;
             }
-            this->_begin[index++] = sum;
         }
-    }
+    });
     return this;
 }
 
@@ -275,6 +308,8 @@ template <typename T>
 template <typename U>
 rowMajorMatrix<T> *rowMajorMatrix<T>::hold(const diagMatrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), (uint64_t)other.rows() * other.cols() * sizeof(T));
     if (checkSize)
         this->resizeLike(other, false, false);
     size_t index = 0;
@@ -288,6 +323,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdAdd(const rowMajorMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)b.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
 
@@ -308,6 +345,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)b.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     if (this != &a)
@@ -327,6 +366,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     
@@ -348,6 +389,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdDiv(const rowMajorMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdDiv, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
     {
         b.checkIsSquare();
@@ -370,6 +413,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdSub(const diagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)b.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)b.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     
@@ -390,6 +435,8 @@ template <typename T>
 template <typename U, typename V>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const diagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)b.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)b.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
 
@@ -411,9 +458,11 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const diagMatrix<U> &a, const rowM
 
 ////////////////////////// rowMajorMatrix and symMatrix //////////////////////////
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
 
@@ -424,7 +473,7 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const
     {
         for (size_t j = 0; j < this->_cols; j++)
         {
-            T sum = 0;
+            A sum = 0;
             const size_t b_index = (j * (j + 1)) >> 1;
             for (size_t k = 0; k < j; k++)
                 sum += a._begin[a_index + k] * b[b_index + k];
@@ -440,9 +489,11 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const
 
 ////////////////////////// colMajorMatrix and symMatrix //////////////////////////
 template <typename T>
-template<typename U, typename V>
+template<typename U, typename V, typename A>
 rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
     if (checkSize)
     MatrixBase<T>::checkSize_mul(a, b);
 
@@ -451,7 +502,7 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const
     {
         for (size_t j = 0; j < this->_cols; j++)
         {
-            T sum = 0;
+            A sum = 0;
             size_t a_index = i;
             const size_t b_index = (j * (j + 1)) >> 1; 
             
@@ -470,3 +521,337 @@ rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const colMajorMatrix<U> &a, const
     }
     return this;
 }
+
+////////////////////////// csrMatrix and rowMajorMatrix //////////////////////////
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const csrMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.nonZeros() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    // each row of the result is a combination of the rows of b selected by the stored values of a
+    const size_t cols = this->_cols;
+    size_t index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        for (size_t j = 0; j < cols; j++)
+            this->_begin[index + j] = 0;
+        const size_t end = a._rowPtr[i + 1];
+        for (size_t k = a._rowPtr[i]; k < end; k++)
+        {
+            const U value = a._begin[k];
+            const V *b_row = b._begin + a._colIndex[k] * b._cols;
+            for (size_t j = 0; j < cols; j++)
+                this->_begin[index + j] += value * b_row[j];
+        }
+        index += cols;
+    }
+    return this;
+}
+
+////////////////////////// rowMajorMatrix and cscMatrix //////////////////////////
+template <typename T>
+template <typename U, typename V, typename A>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const cscMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * b.nonZeros(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    size_t index = 0;
+    size_t a_index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        for (size_t j = 0; j < this->_cols; j++)
+        {
+            A sum = 0;
+            const size_t end = b._colPtr[j + 1];
+            for (size_t k = b._colPtr[j]; k < end; k++)
+                sum += a._begin[a_index + b._rowIndex[k]] * b._begin[k];
+            this->_begin[index++] = sum;
+        }
+        a_index += a._cols;
+    }
+    return this;
+}
+
+////////////////////////// csrMatrix and cscMatrix //////////////////////////
+template <typename T>
+template <typename U>
+rowMajorMatrix<T> *rowMajorMatrix<T>::hold(const csrMatrix<U> &other, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), (uint64_t)other.rows() * other.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::resizeLike(other, false, false);
+    this->fill(0);
+    size_t index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        const size_t end = other._rowPtr[i + 1];
+        for (size_t k = other._rowPtr[i]; k < end; k++)
+            this->_begin[index + other._colIndex[k]] = other._begin[k];
+        index += this->_cols;
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U>
+rowMajorMatrix<T> *rowMajorMatrix<T>::hold(const cscMatrix<U> &other, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(other), (uint64_t)other.rows() * other.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::resizeLike(other, false, false);
+    this->fill(0);
+    for (size_t j = 0; j < this->_cols; j++)
+    {
+        const size_t end = other._colPtr[j + 1];
+        for (size_t k = other._colPtr[j]; k < end; k++)
+            this->_begin[other._rowIndex[k] * this->_cols + j] = other._begin[k];
+    }
+    return this;
+}
+
+////////////////////////// bandMatrix and rowMajorMatrix //////////////////////////
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const bandMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.size() * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    // each row of the result only combines the rows of b inside the band
+    const size_t cols = this->_cols;
+    const size_t w = a.width();
+    size_t index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        for (size_t j = 0; j < cols; j++)
+            this->_begin[index + j] = 0;
+        const size_t first = (i > a._kl) ? i - a._kl : 0;
+        const size_t last = (i + a._ku + 1 < a._cols) ? i + a._ku + 1 : a._cols;
+        const U *a_row = a._begin + i * w + a._kl - i;
+        for (size_t k = first; k < last; k++)
+        {
+            const U value = a_row[k];
+            const V *b_row = b._begin + k * b._cols;
+            for (size_t j = 0; j < cols; j++)
+                this->_begin[index + j] += value * b_row[j];
+        }
+        index += cols;
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const bandMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * b.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    const size_t cols = this->_cols;
+    const size_t w = b.width();
+    size_t index = 0;
+    size_t a_index = 0;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        for (size_t j = 0; j < cols; j++)
+            this->_begin[index + j] = 0;
+        for (size_t k = 0; k < b._rows; k++)
+        {
+            const U value = a._begin[a_index + k];
+            const size_t first = (k > b._kl) ? k - b._kl : 0;
+            const size_t last = (k + b._ku + 1 < cols) ? k + b._ku + 1 : cols;
+            const V *b_row = b._begin + k * w + b._kl - k;
+            for (size_t j = first; j < last; j++)
+                this->_begin[index + j] += value * b_row[j];
+        }
+        index += cols;
+        a_index += a._cols;
+    }
+    return this;
+}
+
+////////////////////////// blockDiagMatrix and rowMajorMatrix //////////////////////////
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const blockDiagMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::blockSum(a, 2) * b.cols(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    this->fill(0);
+    const size_t cols = this->_cols;
+    const size_t blocks = a.blocks();
+    for (size_t k = 0; k < blocks; k++)
+    {
+        const size_t start = a._blockStart[k];
+        const size_t n = a._blockStart[k + 1] - start;
+        const U *block = a._begin + a._blockOffset[k];
+        T *res = this->_begin + start * cols;
+        const V *b_k = b._begin + start * b._cols;
+        const bool sym = a._blockSym[k];
+        for (size_t i = 0; i < n; i++)
+        {
+            T *res_i = res + i * cols;
+            const size_t last = sym ? i + 1 : n;
+            for (size_t j = 0; j < last; j++)
+            {
+                const U value = block[j];
+                const V *b_j = b_k + j * b._cols;
+                for (size_t c = 0; c < cols; c++)
+                    res_i[c] += value * b_j[c];
+                // the upper part of a symmetric block is the transpose of the lower one
+                if (sym && j < i)
+                {
+                    T *res_j = res + j * cols;
+                    const V *b_i = b_k + i * b._cols;
+                    for (size_t c = 0; c < cols; c++)
+                        res_j[c] += value * b_i[c];
+                }
+            }
+            block += last;
+        }
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const blockDiagMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * a.rows() * accounting::blockSum(b, 2), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * b.cols() * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    if (checkOverlap)
+        MatrixBase<T>::checkOverlap(a, b);
+    this->fill(0);
+    const size_t blocks = b.blocks();
+    for (size_t r = 0; r < this->_rows; r++)
+    {
+        const U *a_r = a._begin + r * a._cols;
+        T *res_r = this->_begin + r * this->_cols;
+        for (size_t k = 0; k < blocks; k++)
+        {
+            const size_t start = b._blockStart[k];
+            const size_t n = b._blockStart[k + 1] - start;
+            const V *block = b._begin + b._blockOffset[k];
+            const bool sym = b._blockSym[k];
+            for (size_t i = 0; i < n; i++)
+            {
+                const U value = a_r[start + i];
+                const size_t last = sym ? i + 1 : n;
+                for (size_t j = 0; j < last; j++)
+                {
+                    res_r[start + j] += value * block[j];
+                    if (sym && j < i)
+                        res_r[start + i] += a_r[start + j] * block[j];
+                }
+                block += last;
+            }
+        }
+    }
+    return this;
+}
+
+
+////////////////////////// ldl_matrix and rowMajorMatrix //////////////////////////
+template <typename T>
+template <typename U, typename V>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdSolveLDL(const ldl_matrix<U> &factor, const rowMajorMatrix<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdSolveLDL, b.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)factor.rows() * factor.rows() * b.cols(), accounting::bytes(factor.L) + accounting::bytes(factor.D) + accounting::bytes(b), accounting::bytes(b));
+    if (checkSize)
+    {
+        if (factor.rows() != b.rows())
+            throw "Matrices are not compatible for solving";
+        MatrixBase<T>::resizeLike(b);
+    }
+    if ((const void *)this != (const void *)&b)
+        Vector<T>::hold(b, false);
+    // row operations, along the storage
+    const size_t n = this->_rows;
+    const size_t m = this->_cols;
+    const U *L = factor.L.begin();
+    const U *D = factor.D.begin();
+    // L*Y = B : row i -= L(i,k) * row k, k < i
+    for (size_t i = 1; i < n; i++)
+    {
+        T *row_i = this->_begin + i * m;
+        const U *l_i = L + (((i - 1) * i) >> 1);
+        for (size_t k = 0; k < i; k++)
+        {
+            const T l = l_i[k];
+            const T *row_k = this->_begin + k * m;
+            for (size_t j = 0; j < m; j++)
+                row_i[j] -= l * row_k[j];
+        }
+    }
+    // D*L^T*X = Y : row i = row i / D(i) - L(k,i) * row k, k > i
+    for (size_t i = n; i-- > 0;)
+    {
+        T *row_i = this->_begin + i * m;
+        const T d = T(1) / D[i];
+        for (size_t j = 0; j < m; j++)
+            row_i[j] *= d;
+        for (size_t k = i + 1; k < n; k++)
+        {
+            const T l = L[(((k - 1) * k) >> 1) + i];
+            const T *row_k = this->_begin + k * m;
+            for (size_t j = 0; j < m; j++)
+                row_i[j] -= l * row_k[j];
+        }
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename W>
+rowMajorMatrix<T> *rowMajorMatrix<T>::holdWeightedCross(const colMajorMatrix<U> &a, const Vector<V> &meanA, const colMajorMatrix<U> &b, const Vector<V> &meanB, const Vector<W> &weights, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(rowMajorMatrix, holdMul, a.rows(), b.rows());
+    LINEAR_ALGEBRA_ACCOUNT(3 * (uint64_t)a.rows() * b.rows() * a.cols(), accounting::bytes(a) + accounting::bytes(b) + accounting::bytes(meanA) + accounting::bytes(meanB) + accounting::bytes(weights), (uint64_t)a.rows() * b.rows() * sizeof(T));
+    if (checkSize)
+    {
+        if (a.cols() != b.cols() || weights.size() != a.cols() || meanA.size() != a.rows() || meanB.size() != b.rows())
+            throw "rowMajorMatrix::holdWeightedCross() wrong points, mean or weights size";
+        this->resize(a.rows(), b.rows(), false, false);
+    }
+    const size_t rows = a.rows(), cols = b.rows();
+    this->fill(0);
+    for (size_t k = 0; k < a.cols(); k++)
+    {
+        const U *pa = a.begin() + k * rows;
+        const U *pb = b.begin() + k * cols;
+        const W w = weights.begin()[k];
+        T *row = this->_begin;
+        for (size_t i = 0; i < rows; i++)
+        {
+            const T di = w * (pa[i] - meanA.begin()[i]);
+            for (size_t j = 0; j < cols; j++)
+                row[j] += di * (pb[j] - meanB.begin()[j]);
+            row += cols;
+        }
+    }
+    return this;
+}
\ No newline at end of file
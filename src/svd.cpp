@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define SVD_CPP
+#include "svd.hpp"
+
+template <typename T>
+svd<T>::svd(const size_t rows, const size_t cols) : _rows(rows), _cols(cols), W(rows > cols ? rows : cols, rows > cols ? cols : rows), R(W.cols(), W.cols()), sigma(W.cols()), work(W.rows()), order(W.cols()), tournament(W.cols() + (W.cols() & 1)), rotated(tournament.size() / 2)
+{
+}
+
+template <typename T>
+size_t svd<T>::rotate(const size_t j, const size_t l, const bool vectors)
+{
+    const size_t p = large(), k = small();
+    T *wj = W.begin() + j * p;
+    T *wl = W.begin() + l * p;
+    T alpha = 0, beta = 0, gamma = 0;
+    for (size_t i = 0; i < p; i++)
+    {
+        alpha += wj[i] * wj[i];
+        beta += wl[i] * wl[i];
+        gamma += wj[i] * wl[i];
+    }
+    if (gamma == 0 || internal::reduction::abs(gamma) <= orthogonality() * sqrt(alpha) * sqrt(beta))
+        return 0;
+    // the rotation of tangent t, the smaller root of t^2 + 2 * zeta * t - 1, makes the two columns orthogonal
+    const T zeta = (beta - alpha) / (2 * gamma);
+    const T t = (zeta < 0 ? T(-1) : T(1)) / (internal::reduction::abs(zeta) + sqrt(1 + zeta * zeta));
+    const T c = T(1) / sqrt(1 + t * t), s = c * t;
+    for (size_t i = 0; i < p; i++)
+    {
+        const T x = wj[i], y = wl[i];
+        wj[i] = c * x - s * y;
+        wl[i] = s * x + c * y;
+    }
+    if (vectors)
+    {
+        T *rj = R.begin() + j * k;
+        T *rl = R.begin() + l * k;
+        for (size_t i = 0; i < k; i++)
+        {
+            const T x = rj[i], y = rl[i];
+            rj[i] = c * x - s * y;
+            rl[i] = s * x + c * y;
+        }
+    }
+    return 1;
+}
+
+template <typename T>
+void svd<T>::orthogonalize(const MatrixBase<T> &a, const bool vectors)
+{
+    // 6 * rows * cols^2 flops per sweep (svd.hpp) counted for 8 sweeps, plus the rotations of R
+    const uint64_t p3 = (uint64_t)large() * small() * small(), k3 = (uint64_t)small() * small() * small();
+    LINEAR_ALGEBRA_TRACE_SCOPE(svd, decompose, _rows, _cols);
+    LINEAR_ALGEBRA_ACCOUNT(8 * 6 * (p3 + (vectors ? k3 : 0)), (uint64_t)_rows * _cols * sizeof(T), ((uint64_t)large() * small() + (vectors ? (uint64_t)small() * small() : 0)) * sizeof(T));
+    if (a.rows() != _rows || a.cols() != _cols)
+        throw "svd::compute() wrong size";
+    const size_t p = large(), k = small();
+    T *w = W.begin();
+    if (_rows >= _cols)
+    {
+        for (size_t i = 0; i < _rows; i++)
+            for (size_t j = 0; j < _cols; j++)
+                w[j * p + i] = a(i, j);
+    }
+    else
+    {
+        for (size_t i = 0; i < _rows; i++)
+            for (size_t j = 0; j < _cols; j++)
+                w[i * p + j] = a(i, j);
+    }
+    if (vectors)
+    {
+        R.fill(0);
+        for (size_t i = 0; i < k; i++)
+            R.begin()[i * k + i] = 1;
+    }
+    const size_t n = tournament.size(), pairs = n / 2;
+    for (size_t i = 0; i < n; i++)
+        tournament[i] = i;
+    for (size_t sweep = 0; sweep < 60; sweep++)
+    {
+        size_t rotations = 0;
+        for (size_t round = 0; round + 1 < n; round++)
+        {
+            internal::threadPool::global().forBlocks(pairs, 1, pairs * 3 * (vectors ? p + k : p), [&](const size_t begin, const size_t end)
+            {
+                for (size_t q = begin; q < end; q++)
+                {
+                    const size_t i = tournament[q], j = tournament[n - 1 - q];
+                    rotated[q] = i < k && j < k ? rotate(i < j ? i : j, i < j ? j : i, vectors) : 0;
+                }
+            });
+            for (size_t q = 0; q < pairs; q++)
+                rotations += rotated[q];
+            // the first position stays, the others turn by one
+            const size_t last = tournament[n - 1];
+            for (size_t i = n - 1; i > 1; i--)
+                tournament[i] = tournament[i - 1];
+            tournament[1] = last;
+        }
+        if (rotations == 0)
+        {
+            for (size_t j = 0; j < k; j++)
+            {
+                T sum = 0;
+                for (size_t i = 0; i < p; i++)
+                    sum += w[j * p + i] * w[j * p + i];
+                sigma[j] = sqrt(sum);
+                order[j] = j;
+            }
+            // by decreasing singular value
+            for (size_t i = 1; i < k; i++)
+                for (size_t j = i; j > 0 && sigma[order[j]] > sigma[order[j - 1]]; j--)
+                {
+                    const size_t t = order[j];
+                    order[j] = order[j - 1];
+                    order[j - 1] = t;
+                }
+            return;
+        }
+    }
+    throw "svd::compute() did not converge";
+}
+
+template <typename T>
+void svd<T>::left(rowMajorMatrix<T> &out, const size_t columns)
+{
+    const size_t p = large(), k = small();
+    out.resize(p, columns, false, false);
+    T *u = out.begin();
+    size_t filled = 0;
+    for (; filled < k && sigma[order[filled]] > 0; filled++)
+    {
+        const T *w = W.begin() + order[filled] * p;
+        const T inverse = T(1) / sigma[order[filled]];
+        for (size_t i = 0; i < p; i++)
+            u[i * columns + filled] = w[i] * inverse;
+    }
+    // the null columns and the full mode ones : the unit vectors projected out of the columns already there (twice, for orthogonality), when enough remains of them
+    for (size_t e = 0; filled < columns && e < p; e++)
+    {
+        for (size_t i = 0; i < p; i++)
+            work[i] = i == e;
+        for (size_t pass = 0; pass < 2; pass++)
+            for (size_t c = 0; c < filled; c++)
+            {
+                T dot = 0;
+                for (size_t i = 0; i < p; i++)
+                    dot += u[i * columns + c] * work[i];
+                for (size_t i = 0; i < p; i++)
+                    work[i] -= dot * u[i * columns + c];
+            }
+        T norm = 0;
+        for (size_t i = 0; i < p; i++)
+            norm += work[i] * work[i];
+        norm = sqrt(norm);
+        if (norm < T(0.5))
+            continue;
+        for (size_t i = 0; i < p; i++)
+            u[i * columns + filled] = work[i] / norm;
+        filled++;
+    }
+}
+
+template <typename T>
+void svd<T>::right(rowMajorMatrix<T> &out) const
+{
+    const size_t k = small();
+    out.resize(k, k, false, false);
+    for (size_t i = 0; i < k; i++)
+        for (size_t c = 0; c < k; c++)
+            out.begin()[i * k + c] = R.begin()[order[c] * k + i];
+}
+
+template <typename T>
+Vector<T> *svd<T>::singularValues(Vector<T> &s, const MatrixBase<T> &a)
+{
+    orthogonalize(a, false);
+    s.resize(small(), false, false);
+    for (size_t j = 0; j < small(); j++)
+        s[j] = sigma[order[j]];
+    return &s;
+}
+
+template <typename T>
+svd<T> *svd<T>::compute(Vector<T> &s, rowMajorMatrix<T> &U, rowMajorMatrix<T> &V, const MatrixBase<T> &a, const mode m)
+{
+    orthogonalize(a, true);
+    s.resize(small(), false, false);
+    for (size_t j = 0; j < small(); j++)
+        s[j] = sigma[order[j]];
+    // a = W * R^T, or a^T = W * R^T
+    const size_t columns = m == mode::full ? large() : small();
+    if (_rows >= _cols)
+    {
+        left(U, columns);
+        right(V);
+    }
+    else
+    {
+        left(V, columns);
+        right(U);
+    }
+    return this;
+}
+
+template <typename T>
+size_t svd<T>::rank(T tolerance) const
+{
+    const size_t k = small();
+    if (k == 0)
+        return 0;
+    if (tolerance < 0)
+        tolerance = T(large()) * std::numeric_limits<T>::epsilon() * sigma[order[0]];
+    size_t r = 0;
+    while (r < k && sigma[order[r]] > tolerance)
+        r++;
+    return r;
+}
+
+template <typename T>
+rowMajorMatrix<T> *svd<T>::pinv(rowMajorMatrix<T> &out, const MatrixBase<T> &a, T tolerance)
+{
+    // the decomposition (as in orthogonalize) then k rank one updates of the cols x rows result
+    const uint64_t p3 = (uint64_t)large() * small() * small(), k3 = (uint64_t)small() * small() * small();
+    LINEAR_ALGEBRA_TRACE_SCOPE(svd, holdInv, _cols, _rows);
+    LINEAR_ALGEBRA_ACCOUNT(8 * 6 * (p3 + k3) + 2 * (uint64_t)_rows * _cols * small(), (uint64_t)_rows * _cols * sizeof(T), (uint64_t)_rows * _cols * sizeof(T));
+    orthogonalize(a, true);
+    const size_t p = large(), k = small();
+    if (tolerance < 0)
+        tolerance = k ? T(p) * std::numeric_limits<T>::epsilon() * sigma[order[0]] : T(0);
+    // column j of W is sigma_j * u_j : pinv = sum of r_j * w_j^T / sigma_j^2 (rows >= cols), of w_j * r_j^T / sigma_j^2 otherwise
+    for (size_t j = 0; j < k; j++)
+        work[j] = sigma[j] > tolerance ? T(1) / (sigma[j] * sigma[j]) : T(0);
+    out.resize(_cols, _rows, false, false);
+    out.fill(0);
+    T *o = out.begin();
+    for (size_t j = 0; j < k; j++)
+    {
+        if (work[j] == 0)
+            continue;
+        const T *w = W.begin() + j * p;
+        const T *r = R.begin() + j * k;
+        if (_rows >= _cols)
+            for (size_t i = 0; i < _cols; i++)
+            {
+                const T ri = r[i] * work[j];
+                for (size_t c = 0; c < _rows; c++)
+                    o[i * _rows + c] += ri * w[c];
+            }
+        else
+            for (size_t i = 0; i < _cols; i++)
+            {
+                const T wi = w[i] * work[j];
+                for (size_t c = 0; c < _rows; c++)
+                    o[i * _rows + c] += wi * r[c];
+            }
+    }
+    return &out;
+}
@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define SYM_EIGEN_CPP
+#include "symEigen.hpp"
+
+template <typename T>
+T symEigen<T>::pythag(const T a, const T b)
+{
+    const T x = internal::reduction::abs(a), y = internal::reduction::abs(b);
+    if (x > y)
+        return x * sqrt(1 + (y / x) * (y / x));
+    return y == 0 ? T(0) : y * sqrt(1 + (x / y) * (x / y));
+}
+
+template <typename T>
+void symEigen<T>::jacobi(Vector<T> &values, rowMajorMatrix<T> *vectors)
+{
+    const size_t n = order();
+    T *a = A.begin();
+    T *v = vectors ? vectors->begin() : nullptr;
+    for (size_t sweep = 0; sweep < 50; sweep++)
+    {
+        T off = 0;
+        for (size_t q = 1; q < n; q++)
+            for (size_t r = 0; r < q; r++)
+                off += internal::reduction::abs(a[at(q, r)]);
+        if (off == 0)
+        {
+            for (size_t i = 0; i < n; i++)
+                values[i] = a[at(i, i)];
+            return;
+        }
+        // the first sweeps only rotate the large elements, the later ones flush those that no longer change the diagonal
+        const T threshold = sweep < 3 ? T(0.2) * off / T(n * n) : T(0);
+        for (size_t q = 1; q < n; q++)
+            for (size_t r = 0; r < q; r++)
+            {
+                T &apq = a[at(q, r)];
+                T &app = a[at(r, r)];
+                T &aqq = a[at(q, q)];
+                const T g = 100 * internal::reduction::abs(apq);
+                if (sweep > 3 && internal::reduction::abs(app) + g == internal::reduction::abs(app) && internal::reduction::abs(aqq) + g == internal::reduction::abs(aqq))
+                {
+                    apq = 0;
+                    continue;
+                }
+                if (internal::reduction::abs(apq) <= threshold)
+                    continue;
+                // the rotation (r, q) of tangent t that zeroes a(q, r)
+                T h = aqq - app;
+                T t;
+                if (internal::reduction::abs(h) + g == internal::reduction::abs(h))
+                    t = apq / h;
+                else
+                {
+                    const T theta = T(0.5) * h / apq;
+                    t = T(1) / (internal::reduction::abs(theta) + sqrt(1 + theta * theta));
+                    if (theta < 0)
+                        t = -t;
+                }
+                const T c = T(1) / sqrt(1 + t * t), s = t * c, tau = s / (1 + c);
+                h = t * apq;
+                app -= h;
+                aqq += h;
+                apq = 0;
+                for (size_t k = 0; k < n; k++)
+                {
+                    if (k == r || k == q)
+                        continue;
+                    T &akr = a[at(k, r)];
+                    T &akq = a[at(k, q)];
+                    const T x = akr, y = akq;
+                    akr = x - s * (y + x * tau);
+                    akq = y + s * (x - y * tau);
+                }
+                if (v)
+                    for (size_t k = 0; k < n; k++)
+                    {
+                        const T x = v[k * n + r], y = v[k * n + q];
+                        v[k * n + r] = x - s * (y + x * tau);
+                        v[k * n + q] = y + s * (x - y * tau);
+                    }
+            }
+    }
+    throw "symEigen::compute() jacobi did not converge";
+}
+
+template <typename T>
+void symEigen<T>::tridiagonalize(Vector<T> &values, rowMajorMatrix<T> *vectors)
+{
+    // H_k = I - beta_k * v * v^T zeroes a(k+2.., k), v kept in a(k+1.., k) : A = Q * T * Q^T with Q = H_0 * ... * H_n-3
+    const size_t n = order();
+    T *a = A.begin();
+    for (size_t k = 0; k + 2 < n; k++)
+    {
+        T scale = 0;
+        for (size_t i = k + 1; i < n; i++)
+            scale = internal::reduction::abs(a[at(i, k)]) > scale ? internal::reduction::abs(a[at(i, k)]) : scale;
+        if (scale == 0)
+        {
+            e[k] = 0;
+            beta[k] = 0;
+            continue;
+        }
+        T sum = 0;
+        for (size_t i = k + 1; i < n; i++)
+            sum += (a[at(i, k)] / scale) * (a[at(i, k)] / scale);
+        const T norm = scale * sqrt(sum);
+        T &x0 = a[at(k + 1, k)];
+        const T alpha = x0 < 0 ? norm : -norm;
+        beta[k] = T(1) / (norm * (norm + internal::reduction::abs(x0)));
+        x0 -= alpha;
+        e[k] = alpha;
+        // p = beta * A22 * v, then w = p - (beta / 2 * p^T * v) * v kept in p
+        for (size_t i = k + 1; i < n; i++)
+            p[i] = 0;
+        for (size_t i = k + 1; i < n; i++)
+        {
+            const T vi = a[at(i, k)];
+            T pi = 0;
+            const T *row = a + at(i, k + 1);
+            for (size_t j = k + 1; j < i; j++)
+            {
+                pi += row[j - k - 1] * a[at(j, k)];
+                p[j] += row[j - k - 1] * vi;
+            }
+            p[i] += pi + row[i - k - 1] * vi;
+        }
+        T pv = 0;
+        for (size_t i = k + 1; i < n; i++)
+        {
+            p[i] *= beta[k];
+            pv += p[i] * a[at(i, k)];
+        }
+        const T K = T(0.5) * beta[k] * pv;
+        for (size_t i = k + 1; i < n; i++)
+            p[i] -= K * a[at(i, k)];
+        // A22 -= v * w^T + w * v^T
+        for (size_t i = k + 1; i < n; i++)
+        {
+            const T vi = a[at(i, k)], wi = p[i];
+            T *row = a + at(i, k + 1);
+            for (size_t j = k + 1; j <= i; j++)
+                row[j - k - 1] -= vi * p[j] + wi * a[at(j, k)];
+        }
+    }
+    for (size_t i = 0; i < n; i++)
+        values[i] = a[at(i, i)];
+    if (n > 1)
+    {
+        e[n - 2] = a[at(n - 1, n - 2)];
+        beta[n - 2] = 0;
+    }
+    if (n > 0)
+        e[n - 1] = 0;
+    if (!vectors)
+        return;
+    // V = H_0 * (H_1 * (... * I)), only the columns k+1.. change with H_k
+    T *v = vectors->begin();
+    vectors->fill(0);
+    for (size_t i = 0; i < n; i++)
+        v[i * n + i] = 1;
+    for (size_t k = n > 2 ? n - 2 : 0; k-- > 0;)
+    {
+        if (beta[k] == 0)
+            continue;
+        for (size_t j = k + 1; j < n; j++)
+        {
+            T s = 0;
+            for (size_t i = k + 1; i < n; i++)
+                s += a[at(i, k)] * v[i * n + j];
+            s *= beta[k];
+            for (size_t i = k + 1; i < n; i++)
+                v[i * n + j] -= s * a[at(i, k)];
+        }
+    }
+}
+
+template <typename T>
+void symEigen<T>::ql(Vector<T> &values, rowMajorMatrix<T> *vectors)
+{
+    // QL with implicit shifts on the diagonal d and the subdiagonal e (e[i] couples i and i+1, e[n-1] = 0), the rotations applied to the
+    // columns of V (tql2 of EISPACK, as in JAMA)
+    const size_t n = order();
+    T *d = values.begin();
+    T *v = vectors ? vectors->begin() : nullptr;
+    T f = 0, tst1 = 0;
+    for (size_t l = 0; l < n; l++)
+    {
+        const T size = internal::reduction::abs(d[l]) + internal::reduction::abs(e[l]);
+        tst1 = size > tst1 ? size : tst1;
+        size_t m = l;
+        while (m + 1 < n && internal::reduction::abs(e[m]) + tst1 != tst1)
+            m++;
+        if (m > l)
+        {
+            size_t iterations = 0;
+            do
+            {
+                if (++iterations > 60)
+                    throw "symEigen::compute() ql did not converge";
+                T g = d[l];
+                T q = (d[l + 1] - g) / (2 * e[l]);
+                T r = pythag(q, T(1));
+                if (q < 0)
+                    r = -r;
+                d[l] = e[l] / (q + r);
+                d[l + 1] = e[l] * (q + r);
+                const T dl1 = d[l + 1];
+                T h = g - d[l];
+                for (size_t i = l + 2; i < n; i++)
+                    d[i] -= h;
+                f += h;
+                q = d[m];
+                T c = 1, c2 = 1, c3 = 1, s = 0, s2 = 0;
+                const T el1 = e[l + 1];
+                for (size_t i = m; i-- > l;)
+                {
+                    c3 = c2;
+                    c2 = c;
+                    s2 = s;
+                    g = c * e[i];
+                    h = c * q;
+                    r = pythag(q, e[i]);
+                    e[i + 1] = s * r;
+                    s = e[i] / r;
+                    c = q / r;
+                    q = c * d[i] - s * g;
+                    d[i + 1] = h + s * (c * g + s * d[i]);
+                    if (v)
+                        for (size_t k = 0; k < n; k++)
+                        {
+                            h = v[k * n + i + 1];
+                            v[k * n + i + 1] = s * v[k * n + i] + c * h;
+                            v[k * n + i] = c * v[k * n + i] - s * h;
+                        }
+                }
+                q = -s * s2 * c3 * el1 * e[l] / dl1;
+                e[l] = s * q;
+                d[l] = c * q;
+            } while (internal::reduction::abs(e[l]) + tst1 != tst1);
+        }
+        d[l] += f;
+        e[l] = 0;
+    }
+}
+
+template <typename T>
+void symEigen<T>::sort(Vector<T> &values, rowMajorMatrix<T> *vectors) const
+{
+    const size_t n = order();
+    for (size_t i = 0; i + 1 < n; i++)
+    {
+        size_t k = i;
+        for (size_t j = i + 1; j < n; j++)
+            if (values[j] < values[k])
+                k = j;
+        if (k == i)
+            continue;
+        const T t = values[i];
+        values[i] = values[k];
+        values[k] = t;
+        if (vectors)
+            for (size_t r = 0; r < n; r++)
+            {
+                T &x = vectors->begin()[r * n + i];
+                T &y = vectors->begin()[r * n + k];
+                const T u = x;
+                x = y;
+                y = u;
+            }
+    }
+}
+
+template <typename T>
+void symEigen<T>::decompose(Vector<T> &values, rowMajorMatrix<T> *vectors, const symMatrix<T> &a, const method m)
+{
+    const size_t n = order();
+    const bool useJacobi = m == method::jacobi || (m == method::automatic && n <= _jacobiOrder);
+    // the costs given in symEigen.hpp, jacobi counted for 8 sweeps, its rotations of V doubling them
+    const uint64_t n3 = (uint64_t)n * n * n;
+    LINEAR_ALGEBRA_TRACE_SCOPE(symEigen, decompose, n, n);
+    LINEAR_ALGEBRA_ACCOUNT(useJacobi ? 8 * 3 * n3 * (vectors ? 2 : 1) : 4 * n3 / 3 + (vectors ? 6 * n3 : 30 * (uint64_t)n * n), accounting::packed(n) * sizeof(T), (n + (vectors ? (uint64_t)n * n : 0)) * sizeof(T));
+    if (a.rows() != n)
+        throw "symEigen::compute() wrong size";
+    A.hold(a, false);
+    values.resize(n, false, false);
+    if (vectors)
+        vectors->resize(n, n, false, false);
+    if (useJacobi)
+    {
+        if (vectors)
+        {
+            vectors->fill(0);
+            for (size_t i = 0; i < n; i++)
+                vectors->begin()[i * n + i] = 1;
+        }
+        jacobi(values, vectors);
+    }
+    else
+    {
+        tridiagonalize(values, vectors);
+        ql(values, vectors);
+    }
+    sort(values, vectors);
+}
+
+template <typename T>
+Vector<T> *symEigen<T>::eigenvalues(Vector<T> &values, const symMatrix<T> &a, const method m)
+{
+    decompose(values, nullptr, a, m);
+    return &values;
+}
+
+template <typename T>
+symEigen<T> *symEigen<T>::compute(Vector<T> &values, rowMajorMatrix<T> &vectors, const symMatrix<T> &a, const method m)
+{
+    decompose(values, &vectors, a, m);
+    return this;
+}
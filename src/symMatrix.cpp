@@ -19,6 +19,7 @@
 
 #define SYM_MATRIX_CPP
 #include "symMatrix.hpp"
+#include "threadPool.hpp"
 
 template <typename T>
 const symMatrix<T> symMatrix<T>::staticHelper;
@@ -31,23 +32,52 @@ symMatrix<T>::symMatrix(const size_t rows, const size_t cols) : MatrixBase<T>(ro
     Vector<T>::resize(MatrixBase<T>::minMemorySize(), false, false);
 };
 
+template <typename T>
+template <typename A>
+A symMatrix<T>::trace() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, reduce, this->_rows, this->_cols);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)this->_rows, (uint64_t)this->_rows * sizeof(T), 0);
+    A sum = 0;
+    // the diagonal element of row i ends it, at (i+1)(i+2)/2 - 1
+    for (size_t i = 0, d = 0; i < this->_rows; d += i + 2, i++)
+        sum += this->_begin[d];
+    return sum;
+}
+
+template <typename T>
+template <typename A>
+A symMatrix<T>::frobeniusNorm() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, reduce, this->_rows, this->_cols);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)this->size() + 2 * (uint64_t)this->_rows, accounting::bytes(*this) + (uint64_t)this->_rows * sizeof(T), 0);
+    A diagonal = 0;
+    for (size_t i = 0, d = 0; i < this->_rows; d += i + 2, i++)
+        diagonal += A(this->_begin[d]) * A(this->_begin[d]);
+    return sqrt(2 * internal::reduction::sumSquares<A>(this->_begin, this->size()) - diagonal);
+}
+
 template <typename T>
 template <typename U, typename V>
 symMatrix<T> *symMatrix<T>::holdMul(const symMatrix<U> &a, const symMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
         MatrixBase<T>::checkOverlap(a, b);
 
-    Vector<T>::holdMul(a, b, false);
+    Vector<T>::holdMul((const Vector<U> &)a, (const Vector<V> &)b, false);
     return this;
 };
 
 ////////////////////////////// ldl_matrix //////////////////////////////
 template <typename T>
-template<typename U> symMatrix<T> *symMatrix<T>::holdInv(ldl_matrix<U> &other, const bool checkSize)
+template<typename U, typename A> symMatrix<T> *symMatrix<T>::holdInv(ldl_matrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdInv, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)other.rows() * other.rows() * other.rows(), accounting::bytes(other), accounting::packed(other.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::resizeLike(other);
     // if (checkOverlap)
@@ -57,8 +87,22 @@ template<typename U> symMatrix<T> *symMatrix<T>::holdInv(ldl_matrix<U> &other, c
     other.decompose();
     other.L.holdInv(other.L, false);
     other.D.holdInv(1,other.D, false);
-    using namespace operators;
-    return this->holdMul(*(other.L*other.D).release(),other.LT);
+    // inv(L D L^T) = inv(L)^T inv(D) inv(L), inv(L) being unit lower triangular
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        const size_t index = (i * (i + 1)) >> 1;
+        for (size_t j = 0; j <= i; j++)
+        {
+            A sum = i == j ? other.D[i] : other.D[i] * other.L[(((i - 1) * i) >> 1) + j];
+            for (size_t k = i + 1; k < this->_rows; k++)
+            {
+                const size_t l_index = ((k - 1) * k) >> 1;
+                sum += other.L[l_index + i] * other.D[k] * other.L[l_index + j];
+            }
+            this->_begin[index + j] = sum;
+        }
+    }
+    return this;
 }
 
 
@@ -67,6 +111,8 @@ template <typename T>
 template <typename U>
 symMatrix<T> *symMatrix<T>::hold(const rowMajorMatrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, hold, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::packed(other.rows()) * sizeof(U), accounting::packed(other.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::resizeLike(other);
     size_t index = 0;
@@ -80,8 +126,10 @@ symMatrix<T> *symMatrix<T>::hold(const rowMajorMatrix<U> &other, const bool chec
     return this;
 };
 template <typename T>
-template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
+template<typename U, typename A> symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols(), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -92,7 +140,7 @@ template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U>
     {
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < a.cols(); k++)
                 sum += a._begin[index_a + k] * b._begin[k * b._cols + j];
             this->_begin[index++] = sum;
@@ -104,8 +152,10 @@ template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U>
 };
 
 template <typename T>
-template<typename U> symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
+template<typename U, typename A> symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, addMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols() + accounting::packed(a.rows()), accounting::bytes(a) + accounting::bytes(b) + accounting::packed(a.rows()) * sizeof(T), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -116,7 +166,7 @@ template<typename U> symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U>
     {
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < a.cols(); k++)
                 sum += a._begin[index_a + k] * b._begin[k * b._cols + j];
             this->_begin[index++] += sum;
@@ -127,8 +177,10 @@ template<typename U> symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U>
 };
 
 template <typename T>
-template<typename U> symMatrix<T> *symMatrix<T>::subMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
+template<typename U, typename A> symMatrix<T> *symMatrix<T>::subMul(const rowMajorMatrix<U> &a, const rowMajorMatrix<U> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, subMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols() + accounting::packed(a.rows()), accounting::bytes(a) + accounting::bytes(b) + accounting::packed(a.rows()) * sizeof(T), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -139,7 +191,7 @@ template<typename U> symMatrix<T> *symMatrix<T>::subMul(const rowMajorMatrix<U>
     {
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < a.cols(); k++)
                 sum += a._begin[index_a + k] * b._begin[k * b._cols + j];
             this->_begin[index++] -= sum;
@@ -156,6 +208,8 @@ template <typename T>
 template <typename U, typename V>
 symMatrix<T> *symMatrix<T>::holdAdd(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::packed(a.rows()), accounting::packed(a.rows()) * sizeof(U) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -173,6 +227,8 @@ template <typename T>
 template <typename U, typename V>
 symMatrix<T> *symMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::packed(a.rows()), accounting::packed(a.rows()) * sizeof(U) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -187,9 +243,11 @@ symMatrix<T> *symMatrix<T>::holdSub(const rowMajorMatrix<U> &a, const symMatrix<
 };
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const symMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols(), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     size_t index = 0;
@@ -198,7 +256,7 @@ symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const symMatrix<
     {
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             size_t b_index = ((j * (j + 1)) >> 1);
             for (size_t k = 0; k < j; k++)
                 sum += a._begin[a_index + k] * b._begin[b_index + k];
@@ -217,6 +275,8 @@ template <typename T>
 template <typename U, typename V>
 symMatrix<T> *symMatrix<T>::holdSub(const symMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdSub, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::packed(a.rows()), accounting::bytes(a) + accounting::packed(a.rows()) * sizeof(V), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_add(a, b);
     size_t index = 0;
@@ -231,9 +291,11 @@ symMatrix<T> *symMatrix<T>::holdSub(const symMatrix<U> &a, const rowMajorMatrix<
 };
 
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 symMatrix<T> *symMatrix<T>::holdMul(const symMatrix<U> &a, const rowMajorMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols(), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     // optimized on ESP32
@@ -243,7 +305,7 @@ symMatrix<T> *symMatrix<T>::holdMul(const symMatrix<U> &a, const rowMajorMatrix<
         const size_t a_index = ((i * (i + 1)) >> 1);
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < i; k++)
             {
                 sum += a._begin[a_index + k] * b._begin[k*this->_cols];
@@ -260,8 +322,10 @@ symMatrix<T> *symMatrix<T>::holdMul(const symMatrix<U> &a, const rowMajorMatrix<
 
 ////////////////////////////// triangMatrix and uu_triangMatrix //////////////////////////////
 template <typename T>
-template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const triangMatrix<U> &a, const uu_triangMatrix<U> &b, const bool checkSize)
+template<typename U, typename A> symMatrix<T> *symMatrix<T>::holdMul(const triangMatrix<U> &a, const uu_triangMatrix<U> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.rows() * a.rows() * a.rows() / 3, accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     size_t index = 0;
@@ -271,7 +335,7 @@ template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const triangMatrix<U> &
         for (size_t j = 0; j <= i; j++)
         {
             const size_t b_index = ((j-1) * j) >> 1;
-            T sum = 0;
+            A sum = 0;
             const size_t k_max = (i<j)?i:j;
             for (size_t k = 0; k < k_max; k++)
                 sum += a[a_index + k] * b[b_index + k];
@@ -284,9 +348,55 @@ template<typename U> symMatrix<T> *symMatrix<T>::holdMul(const triangMatrix<U> &
 
 ////////////////////////////// rowMajorMatrix and colMajorMatrix //////////////////////////////
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols(), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
+    if (checkSize)
+        MatrixBase<T>::checkSize_mul(a, b);
+    // the packed elements are split into blocks of the same size whose bounds are multiples of a cache line, so that two blocks never write the same line
+    const size_t count = (this->_rows * (this->_rows + 1)) >> 1;
+    internal::threadPool::global().forBlocks(count, internal::threadPool::rowAlign(sizeof(T)), count * a.cols(), [&](const size_t begin, const size_t end)
+    {
+        // row and column of the first element of the block
+        size_t i = (size_t)((sqrt(8.0 * begin + 1) - 1) / 2);
+        while (((i * (i + 1)) >> 1) > begin)
+            i--;
+        while ((((i + 1) * (i + 2)) >> 1) <= begin)
+            i++;
+        size_t j = begin - ((i * (i + 1)) >> 1);
+        size_t a_index = i * a.cols();
+        size_t b_index = j * b.rows();
+        for (size_t index = begin; index < end; index++)
+        {
+            A sum = 0;
+            for (size_t k = 0; k < a.cols(); k++)
+                sum += a._begin[a_index + k] * b._begin[b_index + k];
+            this->_begin[index] = sum;
+            if (j == i)
+            {
+                i++;
+                j = 0;
+                a_index += a.cols();
+                b_index = 0;
+            }
+            else
+            {
+                j++;
+                b_index += b.rows();
+            }
+        }
+    });
+    return this;
+};
+
+template <typename T>
+template <typename U, typename V, typename A>
+symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, addMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::packed(a.rows()) * a.cols() + accounting::packed(a.rows()), accounting::bytes(a) + accounting::bytes(b) + accounting::packed(a.rows()) * sizeof(T), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     size_t index = 0;
@@ -296,10 +406,10 @@ symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const colMajorMa
         size_t b_index = 0;
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = 0; k < a.cols(); k++)
                 sum += a[a_index + k] * b[b_index + k];
-            this->_begin[index++] = sum;
+            this->_begin[index++] += sum;
             b_index += b.rows();
         }
         a_index += a.cols();
@@ -307,26 +417,118 @@ symMatrix<T> *symMatrix<T>::holdMul(const rowMajorMatrix<U> &a, const colMajorMa
     return this;
 };
 
+////////////////////////////// csrMatrix and symMatrix //////////////////////////////
 template <typename T>
-template <typename U, typename V>
-symMatrix<T> *symMatrix<T>::addMul(const rowMajorMatrix<U> &a, const colMajorMatrix<V> &b, const bool checkSize)
+template <typename U, typename V, typename A>
+symMatrix<T> *symMatrix<T>::holdSandwich(const csrMatrix<U> &a, const symMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdSandwich, a.rows(), a.rows());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::sandwich(a), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
-        MatrixBase<T>::checkSize_mul(a, b);
+    {
+        if (!a.isMultiplicationCompatible(b))
+            throw "Matrices are not compatible for multiplication";
+        this->resize(a._rows, a._rows, false, false);
+    }
+    this->fill(0);
+    return this->template addSandwich<U, V, A>(a, b, false, checkOverlap);
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+symMatrix<T> *symMatrix<T>::addSandwich(const csrMatrix<U> &a, const symMatrix<V> &b, const bool checkSize, const bool checkOverlap)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, addSandwich, a.rows(), a.rows());
+    LINEAR_ALGEBRA_ACCOUNT(accounting::sandwich(a), accounting::bytes(a) + accounting::bytes(b) + accounting::packed(a.rows()) * sizeof(T), accounting::packed(a.rows()) * sizeof(T));
+    if (checkSize)
+    {
+        if (!a.isMultiplicationCompatible(b))
+            throw "Matrices are not compatible for multiplication";
+        if (this->_rows != a._rows)
+            throw "Matrices are not compatible for addition";
+    }
+    if (checkOverlap)
+        if (this->overlap(b))
+            throw "Matrices overlap";
+    // (a*b*a^T)(i,j) = sum over the stored a(i,k) and a(j,l) of a(i,k)*b(k,l)*a(j,l)
     size_t index = 0;
-    size_t a_index = 0;
     for (size_t i = 0; i < this->_rows; i++)
     {
-        size_t b_index = 0;
+        const size_t i_end = a._rowPtr[i + 1];
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
-            for (size_t k = 0; k < a.cols(); k++)
-                sum += a[a_index + k] * b[b_index + k];
+            const size_t j_end = a._rowPtr[j + 1];
+            A sum = 0;
+            for (size_t p = a._rowPtr[i]; p < i_end; p++)
+            {
+                const size_t k = a._colIndex[p];
+                A inner = 0;
+                for (size_t q = a._rowPtr[j]; q < j_end; q++)
+                {
+                    const size_t l = a._colIndex[q];
+                    inner += a._begin[q] * ((k >= l) ? b._begin[((k * (k + 1)) >> 1) + l] : b._begin[((l * (l + 1)) >> 1) + k]);
+                }
+                sum += a._begin[p] * inner;
+            }
             this->_begin[index++] += sum;
-            b_index += b.rows();
         }
-        a_index += a.cols();
     }
     return this;
-};
\ No newline at end of file
+}
+
+template <typename T>
+template <typename U, typename V, typename W>
+symMatrix<T> *symMatrix<T>::holdWeightedCov(const colMajorMatrix<U> &points, const Vector<V> &mean, const Vector<W> &weights, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdMul, points.rows(), points.rows());
+    LINEAR_ALGEBRA_ACCOUNT(3 * accounting::packed(points.rows()) * points.cols(), accounting::bytes(points) + accounting::bytes(mean) + accounting::bytes(weights), accounting::packed(points.rows()) * sizeof(T));
+    if (checkSize)
+    {
+        if (mean.size() != points.rows() || weights.size() != points.cols())
+            throw "symMatrix::holdWeightedCov() wrong mean or weights size";
+        MatrixBase<T>::resize(points.rows(), points.rows(), false, false);
+    }
+    const size_t n = this->_rows;
+    const V *m = mean.begin();
+    this->fill(0);
+    // one point after the other : its column is read along the storage and the packed rows are written in order
+    for (size_t k = 0; k < points.cols(); k++)
+    {
+        const U *point = points.begin() + k * n;
+        const W w = weights.begin()[k];
+        T *row = this->_begin;
+        for (size_t i = 0; i < n; i++)
+        {
+            const T di = w * (point[i] - m[i]);
+            for (size_t j = 0; j <= i; j++)
+                row[j] += di * (point[j] - m[j]);
+            row += i + 1;
+        }
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V>
+symMatrix<T> *symMatrix<T>::holdAddOuter(const T beta, const symMatrix<U> &a, const T alpha, const Vector<V> &u, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(symMatrix, holdAdd, a.rows(), a.cols());
+    LINEAR_ALGEBRA_ACCOUNT(4 * accounting::packed(a.rows()), accounting::bytes(a) + accounting::bytes(u), accounting::packed(a.rows()) * sizeof(T));
+    if (checkSize)
+    {
+        if (a.rows() != u.size())
+            throw "symMatrix::holdAddOuter() wrong vector size";
+        MatrixBase<T>::resizeLike(a, false, false);
+    }
+    const U *source = a.begin();
+    T *row = this->_begin;
+    for (size_t i = 0; i < this->_rows; i++)
+    {
+        const T ui = alpha * u.begin()[i];
+        for (size_t j = 0; j <= i; j++)
+            row[j] = beta * source[j] + ui * u.begin()[j];
+        row += i + 1;
+        source += i + 1;
+    }
+    return this;
+}
@@ -32,11 +32,25 @@ T &triangMatrix<T>::operator()(const size_t row, const size_t col)
     return this->_begin[-1]; 
 };
 
+template <typename T>
+template <typename A>
+A triangMatrix<T>::trace() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(triangMatrix, reduce, this->_rows, this->_cols);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)this->_rows, (uint64_t)this->_rows * sizeof(T), 0);
+    A sum = 0;
+    for (size_t i = 0, d = 0; i < this->_rows; d += i + 2, i++)
+        sum += this->_begin[d];
+    return sum;
+}
+
 // triangMatrix and triangMatrix
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 triangMatrix<T> *triangMatrix<T>::holdMul(const triangMatrix<U> &a, const triangMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(triangMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.rows() * (a.rows() + 1) * (a.rows() + 2) / 3, accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -48,7 +62,7 @@ triangMatrix<T> *triangMatrix<T>::holdMul(const triangMatrix<U> &a, const triang
         const size_t a_index = (i * (i + 1)) >> 1;
         for (size_t j = 0; j <= i; j++)
         {
-            T sum = 0;
+            A sum = 0;
             for (size_t k = j; k <= i; k++)
                 sum += a._begin[a_index + k] * b._begin[((k * (k + 1)) >> 1) + j];
                 
@@ -62,6 +76,8 @@ triangMatrix<T> *triangMatrix<T>::holdMul(const triangMatrix<U> &a, const triang
 template <typename T>
 template<typename U, typename V> triangMatrix<T> *triangMatrix<T>::holdMul(const ul_triangMatrix<U> &a, const diagMatrix<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(triangMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), accounting::packed(a.rows()) * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     size_t index = 0;
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define UD_FILTER_CPP
+#include "ud_filter.hpp"
+
+template <typename T, size_t N, size_t K>
+ud_filter<T, N, K>::ud_filter()
+    : W(N, N + K), weights(N + K), c(N + K), f(N), v(N), fx(N), k(N), x(N), P(N), F(N, N), G(N, K), Q(K)
+{
+    x.fill(0);
+    k.fill(0);
+    P.L.fill(0);
+    P.D.fill(0);
+    Q.fill(0);
+    F.fill(0);
+    G.fill(0);
+    for (size_t i = 0; i < N; i++)
+        F(i, i) = 1;
+    for (size_t i = 0; i < N && i < K; i++)
+        G(i, i) = 1;
+}
+
+template <typename T, size_t N, size_t K>
+ud_filter<T, N, K> *ud_filter<T, N, K>::setCovariance(const symMatrix<T> &covariance)
+{
+    if (covariance.rows() != N)
+        throw "ud_filter::setCovariance() wrong size";
+    P.hold(covariance, false);
+    P.decompose();
+    return this;
+}
+
+template <typename T, size_t N, size_t K>
+template <typename A>
+symMatrix<T> *ud_filter<T, N, K>::getCovariance(symMatrix<T> &out) const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(ud_filter, holdMul, N, N);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)(N - 1) * N * (N + 1) / 2 + accounting::packed(N), (accounting::packed(N - 1) + N) * sizeof(T), accounting::packed(N) * sizeof(T));
+    out.resize(N, N, false, false);
+    const T *L = P.L.begin();
+    const T *D = P.D.begin();
+    size_t index = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        const T *li = L + (((i - 1) * i) >> 1);
+        for (size_t j = 0; j <= i; j++)
+        {
+            const T *lj = L + (((j - 1) * j) >> 1);
+            A sum = i == j ? D[j] : li[j] * D[j];
+            for (size_t m = 0; m < j; m++)
+                sum += li[m] * D[m] * lj[m];
+            out.begin()[index++] = sum;
+        }
+    }
+    return &out;
+}
+
+template <typename T, size_t N, size_t K>
+ud_filter<T, N, K> *ud_filter<T, N, K>::predict()
+{
+    fx.holdMul(F, x, false);
+    return predict(fx);
+}
+
+template <typename T, size_t N, size_t K>
+ud_filter<T, N, K> *ud_filter<T, N, K>::predict(const Vector<T> &fx)
+{
+    typedef typename internal::accumulator<T>::type A;
+    // F*L, then for each row 3 flops per column for D and 4 per column for each row below
+    LINEAR_ALGEBRA_TRACE_SCOPE(ud_filter, predict, N, N + K);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)N * N * (N - 1) + 3 * (uint64_t)N * (N + K) + (uint64_t)N * (N - 1) / 2 * (4 * (N + K) + 1), ((uint64_t)N * N + accounting::packed(N - 1) + 2 * N + (uint64_t)N * K + K) * sizeof(T), (accounting::packed(N - 1) + 2 * N) * sizeof(T));
+    if (fx.size() != N)
+        throw "ud_filter::predict() wrong state size";
+    x.hold(fx, false);
+    T *L = P.L.begin();
+    T *D = P.D.begin();
+    const size_t cols = N + K;
+    // W = [F*L | G], weights = [D | Q]
+    for (size_t i = 0; i < N; i++)
+    {
+        T *wi = W.begin() + i * cols;
+        const T *Fi = F.begin() + i * N;
+        for (size_t j = 0; j < N; j++)
+        {
+            A sum = Fi[j];
+            for (size_t m = j + 1; m < N; m++)
+                sum += Fi[m] * L[(((m - 1) * m) >> 1) + j];
+            wi[j] = sum;
+        }
+        for (size_t j = 0; j < K; j++)
+            wi[N + j] = G.begin()[i * K + j];
+    }
+    for (size_t j = 0; j < N; j++)
+        weights[j] = D[j];
+    for (size_t j = 0; j < K; j++)
+        weights[N + j] = Q.begin()[j];
+    // modified weighted Gram-Schmidt : row j, orthogonalized against the rows above, gives D[j], then it is removed from the rows below
+    for (size_t j = 0; j < N; j++)
+    {
+        T *wj = W.begin() + j * cols;
+        A d = 0;
+        for (size_t m = 0; m < cols; m++)
+        {
+            c[m] = weights[m] * wj[m];
+            d += wj[m] * c[m];
+        }
+        D[j] = d;
+        for (size_t i = j + 1; i < N; i++)
+        {
+            T *wi = W.begin() + i * cols;
+            A s = 0;
+            for (size_t m = 0; m < cols; m++)
+                s += wi[m] * c[m];
+            const T l = d > 0 ? T(s / d) : T(0);
+            L[(((i - 1) * i) >> 1) + j] = l;
+            for (size_t m = 0; m < cols; m++)
+                wi[m] -= l * wj[m];
+        }
+    }
+    return this;
+}
+
+template <typename T, size_t N, size_t K>
+template <typename A>
+ud_filter<T, N, K> *ud_filter<T, N, K>::updateScalar(const T innovation, const T *h, const T r)
+{
+    // f = L^T*h, then 4 flops per element of L and 9 per state
+    LINEAR_ALGEBRA_TRACE_SCOPE(ud_filter, update, N, 1);
+    LINEAR_ALGEBRA_ACCOUNT(3 * (uint64_t)N * (N - 1) + 9 * N, (accounting::packed(N - 1) + 3 * N) * sizeof(T), (accounting::packed(N - 1) + 3 * N) * sizeof(T));
+    T *L = P.L.begin();
+    T *D = P.D.begin();
+    // f = L^T*h, v = D*f
+    for (size_t j = 0; j < N; j++)
+    {
+        A s = h[j];
+        for (size_t m = j + 1; m < N; m++)
+            s += h[m] * L[(((m - 1) * m) >> 1) + j];
+        f[j] = s;
+        v[j] = D[j] * f[j];
+    }
+    // Bierman's update, from the last column of L to the first : k accumulates the unnormalized gain of the columns already updated
+    A a = r;
+    for (size_t j = N; j-- > 0;)
+    {
+        const A before = a;
+        a += v[j] * f[j];
+        D[j] = D[j] * before / a;
+        if (j + 1 < N)
+        {
+            const A lambda = -f[j] / before;
+            for (size_t i = j + 1; i < N; i++)
+            {
+                T &l = L[(((i - 1) * i) >> 1) + j];
+                const T old = l;
+                l = old + lambda * k[i];
+                k[i] += v[j] * old;
+            }
+        }
+        k[j] = v[j];
+    }
+    alpha = a;
+    for (size_t i = 0; i < N; i++)
+    {
+        k[i] /= a;
+        x[i] += k[i] * innovation;
+    }
+    return this;
+}
+
+template <typename T, size_t N, size_t K>
+template <typename A>
+ud_filter<T, N, K> *ud_filter<T, N, K>::update(const T z, const Vector<T> &h, const T r)
+{
+    if (h.size() != N)
+        throw "ud_filter::update() wrong measurement size";
+    A hx = 0;
+    for (size_t j = 0; j < N; j++)
+        hx += h.begin()[j] * x[j];
+    return updateScalar<A>(z - hx, h.begin(), r);
+}
+
+template <typename T, size_t N, size_t K>
+template <typename A>
+ud_filter<T, N, K> *ud_filter<T, N, K>::update(const Vector<T> &z, const rowMajorMatrix<T> &H, const diagMatrix<T> &R)
+{
+    if (H.cols() != N || H.rows() != z.size() || R.rows() != z.size())
+        throw "ud_filter::update() wrong measurement size";
+    for (size_t i = 0; i < z.size(); i++)
+    {
+        const T *h = H.begin() + i * N;
+        A hx = 0;
+        for (size_t j = 0; j < N; j++)
+            hx += h[j] * x[j];
+        updateScalar<A>(z.begin()[i] - hx, h, R.begin()[i]);
+    }
+    return this;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 robinAZERTY [https://github.com/robinAZERTY]
+ *
+ * This file is part of linearAlgebra library.
+ *
+ * linearAlgebra library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * linearAlgebra library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with linearAlgebra library. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define UKF_CPP
+#include "ukf.hpp"
+
+template <typename T, size_t N, size_t M>
+ukf<T, N, M>::ukf(const transition &f, const measurement &h, const T alpha, const T beta, const T kappa)
+    : f(f), h(h), X(N, 2 * N + 1), FX(N, 2 * N + 1), HX(M, 2 * N + 1), wm(2 * N + 1), wc(2 * N + 1), factor(N), S(M),
+      C(M, N), W(M, N), K(N, M), Wt(W.begin(), N, M), zp(M), y(M), x(N), P(N), Q(N), R(M)
+{
+    const T lambda = alpha * alpha * (N + kappa) - N;
+    spread = sqrt(N + lambda);
+    wm.fill(1 / (2 * (N + lambda)));
+    wc.fill(1 / (2 * (N + lambda)));
+    wm[0] = lambda / (N + lambda);
+    wc[0] = wm[0] + 1 - alpha * alpha + beta;
+    x.fill(0);
+    P.fill(0);
+    Q.fill(0);
+    R.fill(0);
+}
+
+template <typename T, size_t N, size_t M>
+ukf<T, N, M> *ukf<T, N, M>::sigmaPoints()
+{
+    factor.hold(P, false);
+    factor.decompose();
+    const T *L = factor.L.begin();
+    T *center = X.begin();
+    for (size_t i = 0; i < N; i++)
+        center[i] = x[i];
+    for (size_t j = 0; j < N; j++)
+    {
+        const T d = factor.D[j];
+        const T s = d > 0 ? T(spread * sqrt(d)) : T(0);
+        T *plus = X.begin() + (1 + j) * N;
+        T *minus = X.begin() + (1 + N + j) * N;
+        // column j of L : 0 above the diagonal, 1 on it
+        for (size_t i = 0; i < j; i++)
+            plus[i] = minus[i] = x[i];
+        plus[j] = x[j] + s;
+        minus[j] = x[j] - s;
+        for (size_t i = j + 1; i < N; i++)
+        {
+            const T offset = s * L[(((i - 1) * i) >> 1) + j];
+            plus[i] = x[i] + offset;
+            minus[i] = x[i] - offset;
+        }
+    }
+    return this;
+}
+
+template <typename T, size_t N, size_t M>
+ukf<T, N, M> *ukf<T, N, M>::predict(const Vector<T> &u)
+{
+    sigmaPoints();
+    f(FX, X, u);
+    x.holdWeightedMean(FX, wm, false);
+    P.holdWeightedCov(FX, x, wc, false);
+    P.holdAdd(P, Q, false);
+    return this;
+}
+
+template <typename T, size_t N, size_t M>
+ukf<T, N, M> *ukf<T, N, M>::update(const Vector<T> &z)
+{
+    if (z.size() != M)
+        throw "ukf::update() wrong measurement size";
+    sigmaPoints();
+    h(HX, X);
+    zp.holdWeightedMean(HX, wm, false);
+    y.holdSub(z, zp, false);
+    S.holdWeightedCov(HX, zp, wc, false);
+    S.holdAdd(S, R, false);
+    C.holdWeightedCross(HX, zp, X, x, wc, false);
+    S.decompose();
+    // W = S^-1*C = K^T
+    W.holdSolveLDL(S, C, false);
+    K.hold(Wt, false);
+    x.addMul(K, y, false);
+    // K*S*K^T = K*C
+    P.subMul(K, C, false, false);
+    return this;
+}
@@ -33,9 +33,11 @@ T &ul_triangMatrix<T>::operator()(const size_t row, const size_t col)
 };
 
 template <typename T>
-template <typename U>
+template <typename U, typename A>
 ul_triangMatrix<T> *ul_triangMatrix<T>::holdInv(const ul_triangMatrix<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(ul_triangMatrix, holdInv, other.rows(), other.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)other.rows() * other.rows() * other.rows() / 3, accounting::bytes(other), (uint64_t)other.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::resizeLike(other, false, false);
 
@@ -44,7 +46,7 @@ ul_triangMatrix<T> *ul_triangMatrix<T>::holdInv(const ul_triangMatrix<U> &other,
         const size_t other_index = (((i - 1) * i) >> 1);
         for (size_t j = 0; j < i; j++)
         {
-            T sum = other._begin[other_index + j];
+            A sum = other._begin[other_index + j];
 
             for (size_t k = j + 1; k < i; k++)
                 sum += other._begin[other_index + k] * this->_begin[(((k - 1) * k) >> 1) + j];
@@ -58,9 +60,11 @@ ul_triangMatrix<T> *ul_triangMatrix<T>::holdInv(const ul_triangMatrix<U> &other,
 
 // ul_triangMatrix and ul_triangMatrix
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 ul_triangMatrix<T> *ul_triangMatrix<T>::holdMul(const ul_triangMatrix<U> &a, const ul_triangMatrix<V> &b, const bool checkSize, const bool checkOverlap)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(ul_triangMatrix, holdMul, a.rows(), b.cols());
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.rows() * a.rows() * a.rows() / 3, accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.size() * sizeof(T));
     if (checkSize)
         MatrixBase<T>::checkSize_mul(a, b);
     if (checkOverlap)
@@ -72,7 +76,7 @@ ul_triangMatrix<T> *ul_triangMatrix<T>::holdMul(const ul_triangMatrix<U> &a, con
         const size_t a_index = (((i - 1) * i) >> 1);
         for (size_t j = 0; j < i; j++)
         {
-            T sum = a._begin[a_index + j] + b._begin[a_index + j];
+            A sum = a._begin[a_index + j] + b._begin[a_index + j];
 
             for (size_t k = j + 1; k < i; k++)
                 sum += a._begin[a_index + k] * b._begin[(((k - 1) * k) >> 1) + j];
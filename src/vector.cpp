@@ -20,6 +20,7 @@
 
 #define VECTOR_CPP
 #include "vector.hpp"
+#include "threadPool.hpp"
 
 template <typename T>
 const Vector<T> Vector<T>::staticHelper = Vector<T>();
@@ -29,6 +30,7 @@ template <typename T>
 Vector<T>::Vector(const size_t N) : Vector()
 {
     internal::alloc_count+=N*sizeof(T);
+    LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, N*sizeof(T), 0);
     _begin = new T[N];
     _end = _begin + N;
     _endOfStorage = _end;
@@ -44,6 +46,7 @@ Vector<T>::Vector(const Vector &v, const bool share) : Vector()
     if (!share)
     {
         internal::alloc_count+=N*sizeof(T);
+        LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, N*sizeof(T), 0);
         memcpy(_begin, v._begin, N * sizeof(T));
     }
 }
@@ -57,6 +60,7 @@ Vector<T>::Vector(T *begin, const size_t N, const bool share) : Vector()
     if (!share)
     {
         internal::alloc_count+=N*sizeof(T);
+        LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, N*sizeof(T), 0);
         memcpy(_begin, begin, N * sizeof(T));
     }
 }
@@ -68,6 +72,7 @@ Vector<T>::~Vector()
     if (!shared())
     {
         internal::alloc_count-=capacity()*sizeof(T);
+        LINEAR_ALGEBRA_TRACE_EVENT(Vector, free, capacity()*sizeof(T), 0);
         delete[] _begin;
     }
 }
@@ -125,6 +130,7 @@ Vector<T> *Vector<T>::allocate(const size_t capacity, const bool deallocIfPossib
     {
         _begin = new T[capacity];
         internal::alloc_count+=capacity*sizeof(T);
+        LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, capacity*sizeof(T), 0);
         _end = _begin + capacity;
         _endOfStorage = _end;
         return this;
@@ -144,6 +150,7 @@ Vector<T> *Vector<T>::allocate(const size_t capacity, const bool deallocIfPossib
     if (newBegin == nullptr)
         return nullptr;
     internal::alloc_count+=capacity*sizeof(T);
+    LINEAR_ALGEBRA_TRACE_EVENT(Vector, alloc, capacity*sizeof(T), 0);
 
     const size_t length = size();
     if (saveData)
@@ -153,6 +160,7 @@ Vector<T> *Vector<T>::allocate(const size_t capacity, const bool deallocIfPossib
     if (_begin)
     {
         internal::alloc_count-=this->capacity()*sizeof(T);
+        LINEAR_ALGEBRA_TRACE_EVENT(Vector, free, this->capacity()*sizeof(T), 0);
         delete[] _begin;
     }
 
@@ -285,23 +293,198 @@ Vector<T> *Vector<T>::insert(const T &value, const size_t index)
 template <typename T>
 Vector<T> *Vector<T>::sort(const bool ascending)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, sort, size(), 1);
+    // comparisons are not counted as FLOP, the traffic is the lower bound of one pass
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(*this), accounting::bytes(*this));
+    if (ascending)
+        internal::sorting::sort(_begin, _end, internal::sorting::less<T>());
+    else
+        internal::sorting::sort(_begin, _end, internal::sorting::greater<T>());
+    return this;
+}
+
+template <typename T>
+Vector<T> *Vector<T>::radixSort(const bool ascending)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, sort, size(), 1);
+    // at most one pass per byte
+    LINEAR_ALGEBRA_ACCOUNT(0, sizeof(T) * accounting::bytes(*this), sizeof(T) * accounting::bytes(*this));
     const size_t N = size();
-    // selectionSort
-    for (size_t i = 0; i < N - 1; i++)
+    if (N < 2)
+        return this;
+    internal::tmp<Vector<T>> *buffer = internal::tmp<Vector<T>>::get(N);
+    internal::sorting::radix(_begin, _end, buffer->_begin, ascending);
+    buffer->release();
+    return this;
+}
+
+namespace internal
+{
+namespace sorting
+{
+    // orders indices by the values they point to, then by index so that argsort is stable
+    template <typename T, typename Less>
+    struct indexLess
     {
-        size_t minIndex = i;
-        for (size_t j = i + 1; j < N; j++)
-            if (ascending ? _begin[j] < _begin[minIndex] : _begin[j] > _begin[minIndex])
-                minIndex = j;
-        internal::swap(_begin[i], _begin[minIndex]);
+        const T *values;
+        Less less;
+        bool operator()(const size_t a, const size_t b) const { return less(values[a], values[b]) || (!less(values[b], values[a]) && a < b); }
+    };
+} // namespace sorting
+} // namespace internal
+
+template <typename T>
+Vector<size_t> *Vector<T>::argsort(Vector<size_t> &indices_holder, const bool ascending) const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, sort, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(*this), accounting::bytes(indices_holder));
+    const size_t N = size();
+    indices_holder.resize(N, false, false);
+    for (size_t i = 0; i < N; i++)
+        indices_holder._begin[i] = i;
+    if (ascending)
+    {
+        internal::sorting::indexLess<T, internal::sorting::less<T>> less = {_begin, internal::sorting::less<T>()};
+        internal::sorting::sort(indices_holder._begin, indices_holder._end, less);
     }
+    else
+    {
+        internal::sorting::indexLess<T, internal::sorting::greater<T>> less = {_begin, internal::sorting::greater<T>()};
+        internal::sorting::sort(indices_holder._begin, indices_holder._end, less);
+    }
+    return &indices_holder;
+}
+
+template <typename T>
+Vector<T> *Vector<T>::nthElement(const size_t k, const bool ascending)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, select, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(*this), accounting::bytes(*this));
+    if (k >= size())
+        return this;
+    if (ascending)
+        internal::sorting::select(_begin, _begin + k, _end, internal::sorting::less<T>());
+    else
+        internal::sorting::select(_begin, _begin + k, _end, internal::sorting::greater<T>());
+    return this;
+}
+
+template <typename T>
+Vector<T> *Vector<T>::partialSort(const size_t k, const bool ascending)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, select, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(*this), accounting::bytes(*this));
+    if (k >= size())
+        return sort(ascending);
+    if (ascending)
+        internal::sorting::partialSort(_begin, _begin + k, _end, internal::sorting::less<T>());
+    else
+        internal::sorting::partialSort(_begin, _begin + k, _end, internal::sorting::greater<T>());
     return this;
 }
 
+template <typename T>
+template <typename A>
+A Vector<T>::sum() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)size(), accounting::bytes(*this), 0);
+    return internal::reduction::sum<A>(_begin, size());
+}
+
+template <typename T>
+template <typename A>
+A Vector<T>::norm1() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)size(), accounting::bytes(*this), 0);
+    return internal::reduction::sumAbs<A>(_begin, size());
+}
+
+template <typename T>
+template <typename A>
+A Vector<T>::norm2Squared() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)size(), accounting::bytes(*this), 0);
+    return internal::reduction::sumSquares<A>(_begin, size());
+}
+
+template <typename T>
+template <typename A>
+A Vector<T>::norm2() const
+{
+    return sqrt(norm2Squared<A>());
+}
+
+template <typename T>
+T Vector<T>::normInf() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)size(), accounting::bytes(*this), 0);
+    return internal::reduction::maxAbs(_begin, size());
+}
+
+template <typename T>
+const size_t Vector<T>::argmin() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)size(), accounting::bytes(*this), 0);
+    if (size() == 0)
+        throw "Vector::argmin() empty vector";
+    return internal::reduction::argBest(_begin, size(), internal::sorting::less<T>());
+}
+
+template <typename T>
+const size_t Vector<T>::argmax() const
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)size(), accounting::bytes(*this), 0);
+    if (size() == 0)
+        throw "Vector::argmax() empty vector";
+    return internal::reduction::argBest(_begin, size(), internal::sorting::greater<T>());
+}
+
+template <typename T>
+T Vector<T>::minimum() const
+{
+    return _begin[argmin()];
+}
+
+template <typename T>
+T Vector<T>::maximum() const
+{
+    return _begin[argmax()];
+}
+
+template <typename T>
+template <typename A>
+A Vector<T>::mean() const
+{
+    if (size() == 0)
+        throw "Vector::mean() empty vector";
+    return sum<A>() / A(size());
+}
+
+template <typename T>
+template <typename A>
+A Vector<T>::variance(const bool sample) const
+{
+    const size_t N = size();
+    if (N < (sample ? 2 : 1))
+        throw "Vector::variance() not enough values";
+    const A m = mean<A>();
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, N, 1);
+    LINEAR_ALGEBRA_ACCOUNT(3 * (uint64_t)N, accounting::bytes(*this), 0);
+    return internal::reduction::sumSquares<A>(_begin, N, m) / A(sample ? N - 1 : N);
+}
+
 template <typename T>
 template <typename U, typename V>
 V Vector<T>::dot(const Vector<U> &other, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, dot, this->size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)this->size(), accounting::bytes(*this) + accounting::bytes(other), 0);
     if (checkSize && size() != other.size())
         throw "Vectors are not compatible for dot product";
     V sum = 0;
@@ -314,6 +497,8 @@ V Vector<T>::dot(const Vector<U> &other, const bool checkSize)
 template <typename T>
 Vector<T> *Vector<T>::hold(T *begin, const size_t N, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, hold, N, 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, (uint64_t)N * sizeof(T), (uint64_t)N * sizeof(T));
     if (checkSize)
         resize(N, false, false);
     memcpy(_begin, begin, N * sizeof(T));
@@ -324,6 +509,8 @@ Vector<T> *Vector<T>::hold(T *begin, const size_t N, const bool checkSize)
 template <typename T>
 Vector<T> *Vector<T>::hold(const Vector &v, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, hold, v.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
     if (checkSize)
         resize(v.size(), false, false);
     if (this == &v)
@@ -337,6 +524,8 @@ template <typename T>
 template <typename U>
 Vector<T> *Vector<T>::hold(const Vector<U> &v, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, hold, v.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(0, accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
     if (checkSize)
         resize(v.size(), false, false);
     const size_t N = size();
@@ -347,9 +536,11 @@ Vector<T> *Vector<T>::hold(const Vector<U> &v, const bool checkSize)
 
 ////////////////////////// matrixBase and Vector //////////////////////////
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 Vector<T> *Vector<T>::holdMul(const MatrixBase<U> &a, const Vector<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.cols(), (uint64_t)a.rows() * a.cols() * sizeof(U) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
     if (checkSize)
         {
             if (a.cols() != b.size())
@@ -363,7 +554,7 @@ Vector<T> *Vector<T>::holdMul(const MatrixBase<U> &a, const Vector<V> &b, const
     size_t size = this->size();
     for (size_t i = 0; i < size; i++)
     {
-        T sum = 0;
+        A sum = 0;
         for (size_t k = 0; k < a.cols(); k++)
             sum += a(i,k) * b._begin[k];
         this->_begin[index++] = sum;
@@ -374,10 +565,131 @@ Vector<T> *Vector<T>::holdMul(const MatrixBase<U> &a, const Vector<V> &b, const
 }
 
 ////////////////////////// rowMajorMatrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename A>
+Vector<T> *Vector<T>::holdRowSum(const rowMajorMatrix<U> &a, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        this->resize(a.rows(), false, false);
+    const size_t cols = a.cols();
+    for (size_t i = 0; i < a.rows(); i++)
+        _begin[i] = internal::reduction::sum<A>(a.begin() + i * cols, cols);
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+Vector<T> *Vector<T>::holdColSum(const rowMajorMatrix<U> &a, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, a.cols(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a), (uint64_t)a.cols() * sizeof(T));
+    if (checkSize)
+        this->resize(a.cols(), false, false);
+    // row after row, along the storage
+    internal::reduction::sumStrided<A>(_begin, a.begin(), a.rows(), a.cols(), a.cols());
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+Vector<T> *Vector<T>::holdRowSum(const colMajorMatrix<U> &a, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        this->resize(a.rows(), false, false);
+    // column after column, along the storage
+    internal::reduction::sumStrided<A>(_begin, a.begin(), a.cols(), a.rows(), a.rows());
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+Vector<T> *Vector<T>::holdColSum(const colMajorMatrix<U> &a, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, a.cols(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)a.size(), accounting::bytes(a), (uint64_t)a.cols() * sizeof(T));
+    if (checkSize)
+        this->resize(a.cols(), false, false);
+    const size_t rows = a.rows();
+    for (size_t j = 0; j < a.cols(); j++)
+        _begin[j] = internal::reduction::sum<A>(a.begin() + j * rows, rows);
+    return this;
+}
+
+template <typename T>
+template <typename U, typename A>
+Vector<T> *Vector<T>::holdCumSum(const Vector<U> &v, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, v.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v.size(), accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
+    if (checkSize)
+        this->resize(v.size(), false, false);
+    internal::reduction::prefixSum<A>(_begin, v.begin(), v.size());
+    return this;
+}
+
 template <typename T>
 template <typename U, typename V>
+Vector<T> *Vector<T>::holdWeightedMean(const colMajorMatrix<U> &points, const Vector<V> &weights, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, reduce, points.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)points.size(), accounting::bytes(points) + accounting::bytes(weights), (uint64_t)points.rows() * sizeof(T));
+    if (checkSize)
+    {
+        if (weights.size() != points.cols())
+            throw "Vector::holdWeightedMean() wrong weights size";
+        this->resize(points.rows(), false, false);
+    }
+    const size_t rows = points.rows();
+    fill(0);
+    for (size_t k = 0; k < points.cols(); k++)
+    {
+        const U *point = points.begin() + k * rows;
+        const V w = weights.begin()[k];
+        for (size_t i = 0; i < rows; i++)
+            _begin[i] += w * point[i];
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdMul(const symMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.rows() * a.rows(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+    {
+        if (a.cols() != b.size())
+            throw "Matrix and vector are not compatible for multiplication";
+        this->resize(a.rows(), false, false);
+    }
+    // row i of the triangle gives its dot product to this[i] and its transpose to the this[j < i]
+    const U *row = a.begin();
+    for (size_t i = 0; i < a.rows(); i++)
+    {
+        const V bi = b.begin()[i];
+        A sum = 0;
+        for (size_t j = 0; j < i; j++)
+        {
+            sum += row[j] * b.begin()[j];
+            _begin[j] += row[j] * bi;
+        }
+        _begin[i] = sum + row[i] * bi;
+        row += i + 1;
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
 Vector<T> *Vector<T>::holdMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
     if (checkSize)
         {
             if (a.cols() != b.size())
@@ -386,24 +698,26 @@ Vector<T> *Vector<T>::holdMul(const rowMajorMatrix<U> &a, const Vector<V> &b, co
         }
 
     // optimized on ESP32
-    size_t index = 0;
-    size_t a_index = 0;
-    size_t size = this->size();
-    for (size_t i = 0; i < size; i++)
+    internal::threadPool::global().forBlocks(this->size(), internal::threadPool::rowAlign(sizeof(T)), this->size() * a._cols, [&](const size_t rowBegin, const size_t rowEnd)
     {
-        T sum = 0;
-        for (size_t k = 0; k < a._cols; k++)
-            sum += a._begin[a_index + k] * b._begin[k];
-        this->_begin[index++] = sum;
-    
-        a_index += a._cols;
-    }
+        size_t a_index = rowBegin * a._cols;
+        for (size_t i = rowBegin; i < rowEnd; i++)
+        {
+            A sum = 0;
+            for (size_t k = 0; k < a._cols; k++)
+                sum += a._begin[a_index + k] * b._begin[k];
+            this->_begin[i] = sum;
+            a_index += a._cols;
+        }
+    });
     return this;
 }
 template <typename T>
-template <typename U, typename V>
+template <typename U, typename V, typename A>
 Vector<T> *Vector<T>::addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, addMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.size() + a.rows(), accounting::bytes(a) + accounting::bytes(b) + (uint64_t)a.rows() * sizeof(T), (uint64_t)a.rows() * sizeof(T));
     if (checkSize)
         {
             if (a.cols() != b.size())
@@ -417,7 +731,7 @@ Vector<T> *Vector<T>::addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, con
     size_t size = this->size();
     for (size_t i = 0; i < size; i++)
     {
-        T sum = 0;
+        A sum = 0;
         for (size_t k = 0; k < a._cols; k++)
             sum += a._begin[a_index + k] * b._begin[k];
         this->_begin[index++] += sum;
@@ -427,6 +741,336 @@ Vector<T> *Vector<T>::addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, con
     return this;
 }
 
+////////////////////////// csrMatrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdMul(const csrMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.nonZeros(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+
+    // only the stored values are visited
+    const size_t *rowPtr = a._rowPtr._begin;
+    const size_t *colIndex = a._colIndex._begin;
+    const size_t size = this->size();
+    for (size_t i = 0; i < size; i++)
+    {
+        A sum = 0;
+        const size_t end = rowPtr[i + 1];
+        for (size_t k = rowPtr[i]; k < end; k++)
+            sum += a._begin[k] * b._begin[colIndex[k]];
+        this->_begin[i] = sum;
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::addMul(const csrMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, addMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.nonZeros() + a.rows(), accounting::bytes(a) + accounting::bytes(b) + (uint64_t)a.rows() * sizeof(T), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+
+    const size_t *rowPtr = a._rowPtr._begin;
+    const size_t *colIndex = a._colIndex._begin;
+    const size_t size = this->size();
+    for (size_t i = 0; i < size; i++)
+    {
+        A sum = 0;
+        const size_t end = rowPtr[i + 1];
+        for (size_t k = rowPtr[i]; k < end; k++)
+            sum += a._begin[k] * b._begin[colIndex[k]];
+        this->_begin[i] += sum;
+    }
+    return this;
+}
+
+////////////////////////// cscMatrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename V>
+Vector<T> *Vector<T>::holdMul(const cscMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.nonZeros(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+    this->fill(0);
+    return this->addMul(a, b, false);
+}
+
+template <typename T>
+template <typename U, typename V>
+Vector<T> *Vector<T>::addMul(const cscMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, addMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.nonZeros() + a.rows(), accounting::bytes(a) + accounting::bytes(b) + (uint64_t)a.rows() * sizeof(T), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+
+    // scatter each column, weighted by the matching element of b
+    const size_t *colPtr = a._colPtr._begin;
+    const size_t *rowIndex = a._rowIndex._begin;
+    const size_t cols = a._cols;
+    for (size_t j = 0; j < cols; j++)
+    {
+        const V bj = b._begin[j];
+        const size_t end = colPtr[j + 1];
+        for (size_t k = colPtr[j]; k < end; k++)
+            this->_begin[rowIndex[k]] += a._begin[k] * bj;
+    }
+    return this;
+}
+
+////////////////////////// bandMatrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdMul(const bandMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.size(), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+    this->fill(0);
+    return this->template addMul<U, V, A>(a, b, false);
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::addMul(const bandMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, addMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)a.size() + a.rows(), accounting::bytes(a) + accounting::bytes(b) + (uint64_t)a.rows() * sizeof(T), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+
+    const size_t w = a.width();
+    const size_t size = this->size();
+    for (size_t i = 0; i < size; i++)
+    {
+        const size_t first = (i > a._kl) ? i - a._kl : 0;
+        const size_t last = (i + a._ku + 1 < a._cols) ? i + a._ku + 1 : a._cols;
+        const U *row = a._begin + i * w + a._kl - i;
+        A sum = 0;
+        for (size_t j = first; j < last; j++)
+            sum += row[j] * b._begin[j];
+        this->_begin[i] += sum;
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdSolveLDL(const bandMatrix<U> &factor, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSolveLDL, factor.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)factor.rows() * (4 * factor.lowerBandwidth() + 1), accounting::bytes(factor) + accounting::bytes(b), (uint64_t)factor.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (factor.rows() != factor.cols() || factor.cols() != b.size())
+                throw "Matrix and vector are not compatible for solving";
+        }
+    this->hold(b, checkSize);
+
+    const size_t n = this->size();
+    const size_t kl = factor._kl;
+    const size_t w = factor.width();
+    // L*y = b
+    for (size_t i = 0; i < n; i++)
+    {
+        const size_t first = (i > kl) ? i - kl : 0;
+        const U *l_i = factor._begin + i * w + kl - i;
+        A sum = this->_begin[i];
+        for (size_t k = first; k < i; k++)
+            sum -= l_i[k] * this->_begin[k];
+        this->_begin[i] = sum;
+    }
+    // D*L^T*x = y
+    for (size_t i = n; i-- > 0;)
+    {
+        const size_t last = (i + kl + 1 < n) ? i + kl + 1 : n;
+        A sum = this->_begin[i] / factor._begin[i * w + kl];
+        for (size_t k = i + 1; k < last; k++)
+            sum -= factor._begin[k * w + kl + i - k] * this->_begin[k];
+        this->_begin[i] = sum;
+    }
+    return this;
+}
+
+////////////////////////// ldl_matrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdSolveLDL(const ldl_matrix<U> &factor, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSolveLDL, factor.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * (uint64_t)factor.rows() * factor.rows(), accounting::bytes(factor.L) + accounting::bytes(factor.D) + accounting::bytes(b), (uint64_t)factor.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (factor.rows() != b.size())
+                throw "Matrix and vector are not compatible for solving";
+        }
+    if ((const void *)this != (const void *)&b)
+        this->hold(b, checkSize);
+
+    const size_t n = this->size();
+    const U *L = factor.L.begin();
+    const U *D = factor.D.begin();
+    // L*y = b
+    for (size_t i = 1; i < n; i++)
+    {
+        const U *l_i = L + (((i - 1) * i) >> 1);
+        A sum = this->_begin[i];
+        for (size_t k = 0; k < i; k++)
+            sum -= l_i[k] * this->_begin[k];
+        this->_begin[i] = sum;
+    }
+    // D*L^T*x = y
+    for (size_t i = n; i-- > 0;)
+    {
+        A sum = this->_begin[i] / D[i];
+        for (size_t k = i + 1; k < n; k++)
+            sum -= L[(((k - 1) * k) >> 1) + i] * this->_begin[k];
+        this->_begin[i] = sum;
+    }
+    return this;
+}
+
+////////////////////////// blockDiagMatrix and Vector //////////////////////////
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdMul(const blockDiagMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::blockSum(a, 2), accounting::bytes(a) + accounting::bytes(b), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+    this->fill(0);
+    return this->template addMul<U, V, A>(a, b, false);
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::addMul(const blockDiagMatrix<U> &a, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, addMul, a.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::blockSum(a, 2) + a.rows(), accounting::bytes(a) + accounting::bytes(b) + (uint64_t)a.rows() * sizeof(T), (uint64_t)a.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (a.cols() != b.size())
+                throw "Matrix and vector are not compatible for multiplication";
+            this->resize(a.rows(), false, false);
+        }
+
+    const size_t blocks = a.blocks();
+    for (size_t k = 0; k < blocks; k++)
+    {
+        const size_t start = a._blockStart[k];
+        const size_t n = a._blockStart[k + 1] - start;
+        const U *block = a._begin + a._blockOffset[k];
+        const V *b_k = b._begin + start;
+        T *y = this->_begin + start;
+        if (a._blockSym[k])
+        {
+            // a single pass over the packed storage, each off-diagonal element contributes twice
+            for (size_t i = 0; i < n; i++)
+            {
+                A sum = 0;
+                for (size_t j = 0; j < i; j++)
+                {
+                    sum += block[j] * b_k[j];
+                    y[j] += block[j] * b_k[i];
+                }
+                y[i] += sum + block[i] * b_k[i];
+                block += i + 1;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                A sum = 0;
+                for (size_t j = 0; j < n; j++)
+                    sum += block[j] * b_k[j];
+                y[i] += sum;
+                block += n;
+            }
+        }
+    }
+    return this;
+}
+
+template <typename T>
+template <typename U, typename V, typename A>
+Vector<T> *Vector<T>::holdSolveLDL(const blockDiagMatrix<U> &factor, const Vector<V> &b, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSolveLDL, factor.rows(), 1);
+    LINEAR_ALGEBRA_ACCOUNT(2 * accounting::blockSum(factor, 2) + factor.rows(), accounting::bytes(factor) + accounting::bytes(b), (uint64_t)factor.rows() * sizeof(T));
+    if (checkSize)
+        {
+            if (factor.cols() != b.size())
+                throw "Matrix and vector are not compatible for solving";
+        }
+    this->hold(b, checkSize);
+
+    const size_t blocks = factor.blocks();
+    for (size_t k = 0; k < blocks; k++)
+    {
+        const size_t start = factor._blockStart[k];
+        const size_t n = factor._blockStart[k + 1] - start;
+        const U *l = factor._begin + factor._blockOffset[k];
+        T *x = this->_begin + start;
+        // L*y = b
+        for (size_t i = 0; i < n; i++)
+        {
+            const U *l_i = l + ((i * (i + 1)) >> 1);
+            A sum = x[i];
+            for (size_t j = 0; j < i; j++)
+                sum -= l_i[j] * x[j];
+            x[i] = sum;
+        }
+        // D*L^T*x = y
+        for (size_t i = n; i-- > 0;)
+        {
+            A sum = x[i] / l[((i * (i + 1)) >> 1) + i];
+            for (size_t j = i + 1; j < n; j++)
+                sum -= l[((j * (j + 1)) >> 1) + i] * x[j];
+            x[i] = sum;
+        }
+    }
+    return this;
+}
+
 // symatrix and vector
 // template <typename T>
 // template <typename U, typename V>
@@ -445,7 +1089,7 @@ Vector<T> *Vector<T>::addMul(const rowMajorMatrix<U> &a, const Vector<V> &b, con
 //     size_t size = this->size();
 //     for (size_t i = 0; i < size; i++)
 //     {
-//         T sum = 0;
+//         A sum = 0;
 //         for (size_t k = 0; k < a._cols; k++)
 //             sum += a(i,k) * b._begin[k];
 //         this->_begin[index++] = sum;
@@ -459,6 +1103,8 @@ template <typename T>
 template <typename U, typename V>
 Vector<T> *Vector<T>::holdAdd(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdAdd, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1) + accounting::bytes(v2), (uint64_t)v1.size() * sizeof(T));
     if (checkSize)
         resize(v1.size(), false, false);
     const size_t N = size();
@@ -471,6 +1117,8 @@ template <typename T>
 template <typename U, typename V>
 Vector<T> *Vector<T>::holdSub(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSub, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1) + accounting::bytes(v2), (uint64_t)v1.size() * sizeof(T));
     if (checkSize)
         resize(v1.size(), false, false);
     const size_t N = size();
@@ -483,6 +1131,8 @@ template <typename T>
 template <typename U, typename V>
 Vector<T> *Vector<T>::holdMul(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1) + accounting::bytes(v2), (uint64_t)v1.size() * sizeof(T));
     if (checkSize)
         resize(v1.size(), false, false);
     const size_t N = size();
@@ -494,6 +1144,8 @@ template <typename T>
 template <typename U, typename V>
 Vector<T> *Vector<T>::holdDiv(const Vector<U> &v1, const Vector<V> &v2, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdDiv, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1) + accounting::bytes(v2), (uint64_t)v1.size() * sizeof(T));
     if (checkSize)
         resize(v1.size(), false, false);
     const size_t N = size();
@@ -506,6 +1158,8 @@ template <typename T>
 template <typename U>
 Vector<T> *Vector<T>::holdAdd(const Vector<U> &v1, const T val, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdAdd, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1), (uint64_t)v1.size() * sizeof(T));
     const size_t N = v1.size();
     if (checkSize)
         resize(N, false, false);
@@ -518,6 +1172,8 @@ template <typename T>
 template <typename U>
 Vector<T> *Vector<T>::holdSub(const Vector<U> &v1, const T val, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSub, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1), (uint64_t)v1.size() * sizeof(T));
     const size_t N = v1.size();
     if (checkSize)
         resize(N, false, false);
@@ -530,6 +1186,8 @@ template <typename T>
 template <typename U, typename V>
 Vector<T> *Vector<T>::holdMul(const Vector<U> &v1, const V val, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdMul, v1.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v1.size(), accounting::bytes(v1), (uint64_t)v1.size() * sizeof(T));
     const size_t N = v1.size();
     if (checkSize)
         resize(N, false, false);
@@ -542,6 +1200,8 @@ template <typename T>
 template <typename U>
 Vector<T> *Vector<T>::holdSub(const T val, const Vector<U> &v, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdSub, v.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v.size(), accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
     const size_t N = v.size();
     if (checkSize)
         resize(N, false, false);
@@ -554,6 +1214,8 @@ template <typename T>
 template <typename U>
 Vector<T> *Vector<T>::holdDiv(const T val, const Vector<U> &v, const bool checkSize)
 {
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, holdDiv, v.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v.size(), accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
     const size_t N = v.size();
     if (checkSize)
         resize(N, false, false);
@@ -562,6 +1224,119 @@ Vector<T> *Vector<T>::holdDiv(const T val, const Vector<U> &v, const bool checkS
     return this;
 }
 
+template <typename T>
+template <typename U, typename F>
+Vector<T> *Vector<T>::holdMap(const Vector<U> &v, const F &f, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, map, v.size(), 1);
+    // one operation per element, whatever f costs
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)v.size(), accounting::bytes(v), (uint64_t)v.size() * sizeof(T));
+    const size_t N = v.size();
+    if (checkSize)
+        resize(N, false, false);
+    for (size_t i = 0; i < N; i++)
+        _begin[i] = f(v._begin[i]);
+    return this;
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdSqrt(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::sqrt((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return sqrt(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdRsqrt(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::rsqrt((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return 1 / sqrt(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdExp(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::exp((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return exp(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdLog(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::log((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return log(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdSin(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::sin((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return sin(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdCos(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::cos((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return cos(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U>
+Vector<T> *Vector<T>::holdTanh(const Vector<U> &v, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    if (accuracy == fastMath::accuracy::fast)
+        return holdMap(v, [](const U x) { return fastMath::tanh((float)x); }, checkSize);
+    return holdMap(v, [](const U x) { return tanh(x); }, checkSize);
+}
+
+template <typename T>
+template <typename U, typename V>
+Vector<T> *Vector<T>::holdAtan2(const Vector<U> &y, const Vector<V> &x, const fastMath::accuracy accuracy, const bool checkSize)
+{
+    LINEAR_ALGEBRA_TRACE_SCOPE(Vector, map, y.size(), 1);
+    LINEAR_ALGEBRA_ACCOUNT((uint64_t)y.size(), accounting::bytes(y) + accounting::bytes(x), (uint64_t)y.size() * sizeof(T));
+    const size_t N = y.size();
+    if (checkSize)
+    {
+        if (x.size() != N)
+            throw "Vectors are not compatible for atan2";
+        resize(N, false, false);
+    }
+    if (accuracy == fastMath::accuracy::fast)
+        for (size_t i = 0; i < N; i++)
+            _begin[i] = fastMath::atan2((float)y._begin[i], (float)x._begin[i]);
+    else
+        for (size_t i = 0; i < N; i++)
+            _begin[i] = atan2(y._begin[i], x._begin[i]);
+    return this;
+}
+
+template <typename T>
+template <typename A>
+Vector<T> *Vector<T>::normalize(const fastMath::accuracy accuracy)
+{
+    const A squares = norm2Squared<A>();
+    if (squares == A())
+        return this;
+    // the fast path computes in float : a norm outside of its normal range takes the full one
+    if (accuracy == fastMath::accuracy::fast && squares >= A(1.17549435e-38f) && squares <= A(3.40282347e38f))
+        return holdMul(*this, fastMath::rsqrt((float)squares), false);
+    return holdMul(*this, A(1) / sqrt(squares), false);
+}
+
 template <typename T>
 template <typename U>
 const bool Vector<T>::operator==(const Vector<U> &v) const
@@ -0,0 +1,396 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <linearAlgebra.hpp>
+#include <cstdlib>
+#include <new>
+
+// counts the heap allocations made while counting is set
+static bool counting = false;
+static size_t allocations = 0;
+void *operator new(size_t size) {
+    if (counting)
+        allocations++;
+    void *p = malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+double maxDifference(const rowMajorMatrix<double> &a, const rowMajorMatrix<double> &b) {
+    double d = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        d = fabs(a.begin()[i] - b.begin()[i]) > d ? fabs(a.begin()[i] - b.begin()[i]) : d;
+    return d;
+}
+
+void test_expm(void) {
+    expm<double> exponential(2);
+    rowMajorMatrix<double> a(2, 2), e(2, 2), expected(2, 2);
+    // rotations, the largest ones scaled down by 2^6 then squared back
+    const double angles[] = {0.1, 1, 20};
+    for (size_t k = 0; k < 3; k++) {
+        const double t = angles[k];
+        a(0, 0) = a(1, 1) = 0;
+        a(0, 1) = -t;
+        a(1, 0) = t;
+        expected(0, 0) = expected(1, 1) = cos(t);
+        expected(0, 1) = -sin(t);
+        expected(1, 0) = sin(t);
+        allocations = 0;
+        counting = true;
+        exponential.compute(e, a);
+        counting = false;
+        TEST_ASSERT_EQUAL(0, allocations);
+        TEST_ASSERT_TRUE(maxDifference(e, expected) < 1e-13 * (1 + t));
+    }
+    // a Jordan block : exp([l, 1; 0, l]) = e^l * [1, 1; 0, 1]
+    a(0, 0) = a(1, 1) = -3;
+    a(0, 1) = 1;
+    a(1, 0) = 0;
+    exponential.compute(e, a);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, exp(-3.0), e(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, exp(-3.0), e(0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0, e(1, 0));
+    // the truncated series for a short step
+    a(0, 1) = 0.01;
+    a(0, 0) = a(1, 1) = -0.03;
+    exponential.compute(expected, a);
+    exponential.compute(e, a, expm<double>::method::taylor, 8);
+    TEST_ASSERT_TRUE(maxDifference(e, expected) < 1e-15);
+    exponential.compute(e, a, expm<double>::method::taylor, 2);
+    TEST_ASSERT_TRUE(maxDifference(e, expected) < 1e-5);
+    TEST_ASSERT_TRUE(maxDifference(e, expected) > 1e-7);
+    bool thrown = false;
+    try { exponential.compute(a, a); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_vanLoan(void) {
+    // constant velocity driven by a white acceleration of density q
+    const double q = 0.3, dt = 0.1;
+    vanLoan<double> discretization(2);
+    rowMajorMatrix<double> a(2, 2), F;
+    symMatrix<double> Q(2), Qd;
+    a.fill(0);
+    a(0, 1) = 1;
+    Q.fill(0);
+    Q(1, 1) = q;
+    discretization.discretize(F, Qd, a, Q, dt);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 1, F(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, dt, F(0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 0, F(1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, 1, F(1, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, q * dt * dt * dt / 3, Qd(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, q * dt * dt / 2, Qd(1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-15, q * dt, Qd(1, 1));
+
+    // first order lag and a second state coupled to it : compared with F, Qd = integral of exp(A t) Q exp(A^T t) by the trapezoidal rule
+    a(0, 0) = -2;
+    a(0, 1) = 0.5;
+    a(1, 0) = 0;
+    a(1, 1) = -1;
+    Q(0, 0) = 0.2;
+    Q(1, 0) = 0.05;
+    allocations = 0;
+    counting = true;
+    discretization.discretize(F, Qd, a, Q, dt);
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    expm<double> exponential(2);
+    rowMajorMatrix<double> at(2, 2), e(2, 2);
+    exponential.compute(e, *at.holdMul(a, dt));
+    TEST_ASSERT_TRUE(maxDifference(e, F) < 1e-15);
+    const size_t steps = 2000;
+    double integral[3] = {0, 0, 0};
+    for (size_t k = 0; k <= steps; k++) {
+        const double t = dt * k / steps;
+        exponential.compute(e, *at.holdMul(a, t));
+        double eq[2][2];
+        for (size_t i = 0; i < 2; i++)
+            for (size_t j = 0; j < 2; j++)
+                eq[i][j] = e(i, 0) * Q(0, j) + e(i, 1) * Q(1, j);
+        const double w = (k == 0 || k == steps) ? 0.5 : 1;
+        integral[0] += w * (eq[0][0] * e(0, 0) + eq[0][1] * e(0, 1));
+        integral[1] += w * (eq[1][0] * e(0, 0) + eq[1][1] * e(0, 1));
+        integral[2] += w * (eq[1][0] * e(1, 0) + eq[1][1] * e(1, 1));
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, integral[0] * dt / steps, Qd(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, integral[1] * dt / steps, Qd(1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, integral[2] * dt / steps, Qd(1, 1));
+    // the series is enough for such a step
+    symMatrix<double> series;
+    rowMajorMatrix<double> Fseries;
+    discretization.discretize(Fseries, series, a, Q, dt, expm<double>::method::taylor, 12);
+    TEST_ASSERT_TRUE(maxDifference(F, Fseries) < 1e-14);
+    for (size_t i = 0; i < 3; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-15, Qd.begin()[i], series.begin()[i]);
+}
+
+// largest |a - V diag(values) V^T| and |V^T V - I|
+void checkEigen(const symMatrix<double> &a, const Vector<double> &values, const rowMajorMatrix<double> &V, const double tolerance) {
+    const size_t n = a.rows();
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++) {
+            double r = 0, o = 0;
+            for (size_t k = 0; k < n; k++) {
+                r += V.begin()[i * n + k] * values.begin()[k] * V.begin()[j * n + k];
+                o += V.begin()[k * n + i] * V.begin()[k * n + j];
+            }
+            TEST_ASSERT_DOUBLE_WITHIN(tolerance, a.begin()[i * (i + 1) / 2 + j], r);
+            TEST_ASSERT_DOUBLE_WITHIN(tolerance, i == j ? 1 : 0, o);
+        }
+    for (size_t i = 1; i < n; i++)
+        TEST_ASSERT_TRUE(values.begin()[i - 1] <= values.begin()[i]);
+}
+
+void test_symEigen(void) {
+    typedef symEigen<double>::method method;
+    // the second difference matrix, eigenvalues 2 - 2 * cos(k * pi / (n + 1))
+    for (size_t n = 1; n <= 10; n += 3) {
+        symMatrix<double> a(n);
+        a.fill(0);
+        for (size_t i = 0; i < n; i++) {
+            a(i, i) = 2;
+            if (i)
+                a(i, i - 1) = -1;
+        }
+        symEigen<double> eigen(n);
+        Vector<double> values;
+        rowMajorMatrix<double> V;
+        const method methods[] = {method::jacobi, method::tridiagonal};
+        for (size_t m = 0; m < 2; m++) {
+            eigen.compute(values, V, a, methods[m]);
+            for (size_t k = 0; k < n; k++)
+                TEST_ASSERT_DOUBLE_WITHIN(1e-14, 2 - 2 * cos((k + 1) * M_PI / (n + 1)), values[k]);
+            checkEigen(a, values, V, 1e-14);
+        }
+    }
+
+    // a random covariance of order 12, and the identity (all the eigenvalues repeated)
+    const size_t n = 12;
+    rowMajorMatrix<double> B(n, n);
+    unsigned int seed = 7;
+    for (size_t i = 0; i < n * n; i++) {
+        seed = seed * 1103515245 + 12345;
+        B.begin()[i] = ((seed >> 8) & 0xffff) / 32768.0 - 1;
+    }
+    symMatrix<double> a(n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++) {
+            double s = i == j ? 1e-3 : 0;
+            for (size_t k = 0; k < n; k++)
+                s += B(i, k) * B(j, k);
+            a(i, j) = s;
+        }
+    symEigen<double> eigen(n);
+    Vector<double> values(n), jacobiValues(n), onlyValues(n);
+    rowMajorMatrix<double> V(n, n);
+    allocations = 0;
+    counting = true;
+    eigen.compute(values, V, a);
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    checkEigen(a, values, V, 1e-12);
+    TEST_ASSERT_TRUE(values[0] > 0);
+    eigen.compute(jacobiValues, V, a, method::jacobi);
+    checkEigen(a, jacobiValues, V, 1e-12);
+    counting = true;
+    eigen.eigenvalues(onlyValues, a);
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    double trace = 0, sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, values[i], jacobiValues[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, values[i], onlyValues[i]);
+        trace += a(i, i);
+        sum += values[i];
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, trace, sum);
+    eigen.eigenvalues(onlyValues, a, method::jacobi);
+    for (size_t i = 0; i < n; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, values[i], onlyValues[i]);
+
+    a.fill(0);
+    for (size_t i = 0; i < n; i++)
+        a(i, i) = 1;
+    eigen.compute(values, V, a, method::tridiagonal);
+    checkEigen(a, values, V, 1e-15);
+    bool thrown = false;
+    try { eigen.eigenvalues(values, symMatrix<double>(3)); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+// largest |a - U diag(s) V^T|, |U^T U - I| and |V^T V - I| against tolerance
+void checkSvd(const MatrixBase<double> &a, const Vector<double> &s, const rowMajorMatrix<double> &U, const rowMajorMatrix<double> &V, const double tolerance) {
+    const size_t k = s.size();
+    for (size_t i = 0; i < a.rows(); i++)
+        for (size_t j = 0; j < a.cols(); j++) {
+            double r = 0;
+            for (size_t c = 0; c < k; c++)
+                r += U.begin()[i * U.cols() + c] * s.begin()[c] * V.begin()[j * V.cols() + c];
+            TEST_ASSERT_DOUBLE_WITHIN(tolerance, a(i, j), r);
+        }
+    const rowMajorMatrix<double> *factors[] = {&U, &V};
+    for (size_t f = 0; f < 2; f++) {
+        const rowMajorMatrix<double> &M = *factors[f];
+        for (size_t i = 0; i < M.cols(); i++)
+            for (size_t j = 0; j < M.cols(); j++) {
+                double o = 0;
+                for (size_t r = 0; r < M.rows(); r++)
+                    o += M.begin()[r * M.cols() + i] * M.begin()[r * M.cols() + j];
+                TEST_ASSERT_DOUBLE_WITHIN(tolerance, i == j ? 1 : 0, o);
+            }
+    }
+    for (size_t i = 1; i < k; i++)
+        TEST_ASSERT_TRUE(s.begin()[i - 1] >= s.begin()[i]);
+}
+
+void fillRandom(MatrixBase<double> &a, unsigned int seed) {
+    for (size_t i = 0; i < a.rows(); i++)
+        for (size_t j = 0; j < a.cols(); j++) {
+            seed = seed * 1103515245 + 12345;
+            a(i, j) = ((seed >> 8) & 0xffff) / 32768.0 - 1;
+        }
+}
+
+void test_svd(void) {
+    typedef svd<double>::mode mode;
+    // tall : the singular values are the square roots of the eigenvalues of a^T * a
+    rowMajorMatrix<double> a(9, 5), U, V;
+    fillRandom(a, 3);
+    svd<double> tall(9, 5);
+    Vector<double> s(5), values(5);
+    tall.compute(s, U, V, a);
+    TEST_ASSERT_EQUAL(9, U.rows());
+    TEST_ASSERT_EQUAL(5, U.cols());
+    TEST_ASSERT_EQUAL(5, V.rows());
+    checkSvd(a, s, U, V, 1e-13);
+    symMatrix<double> ata(5);
+    for (size_t i = 0; i < 5; i++)
+        for (size_t j = 0; j <= i; j++) {
+            ata(i, j) = 0;
+            for (size_t r = 0; r < 9; r++)
+                ata(i, j) += a(r, i) * a(r, j);
+        }
+    symEigen<double> eigen(5);
+    eigen.eigenvalues(values, ata);
+    for (size_t i = 0; i < 5; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-13, sqrt(values[4 - i]), s[i]);
+    allocations = 0;
+    counting = true;
+    tall.compute(s, U, V, a);
+    tall.singularValues(values, a);
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY(s.begin(), values.begin(), 5);
+    tall.compute(s, U, V, a, mode::full);
+    TEST_ASSERT_EQUAL(9, U.cols());
+    checkSvd(a, s, U, V, 1e-13);
+    // full rank : pinv(a) * a = I
+    rowMajorMatrix<double> X;
+    tall.pinv(X, a);
+    TEST_ASSERT_EQUAL(5, X.rows());
+    TEST_ASSERT_EQUAL(9, X.cols());
+    for (size_t i = 0; i < 5; i++)
+        for (size_t j = 0; j < 5; j++) {
+            double r = 0;
+            for (size_t k = 0; k < 9; k++)
+                r += X(i, k) * a(k, j);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-13, i == j ? 1 : 0, r);
+        }
+
+    // wide, colMajorMatrix, rank 3 : the last row is a combination of two others
+    colMajorMatrix<double> b(4, 6);
+    fillRandom(b, 11);
+    for (size_t j = 0; j < 6; j++)
+        b(3, j) = b(0, j) - 2 * b(1, j);
+    svd<double> wide(4, 6);
+    wide.compute(s, U, V, b);
+    TEST_ASSERT_EQUAL(4, s.size());
+    TEST_ASSERT_EQUAL(6, V.rows());
+    TEST_ASSERT_EQUAL(4, V.cols());
+    checkSvd(b, s, U, V, 1e-13);
+    TEST_ASSERT_EQUAL(3, wide.rank());
+    TEST_ASSERT_TRUE(s[3] < 1e-14);
+    wide.compute(s, U, V, b, mode::full);
+    TEST_ASSERT_EQUAL(6, V.cols());
+    checkSvd(b, s, U, V, 1e-13);
+    // the Penrose conditions : b * X * b = b and X * b * X = X
+    wide.pinv(X, b);
+    rowMajorMatrix<double> bX(4, 4), Xb(6, 6);
+    for (size_t i = 0; i < 4; i++)
+        for (size_t j = 0; j < 4; j++) {
+            bX(i, j) = 0;
+            for (size_t k = 0; k < 6; k++)
+                bX(i, j) += b(i, k) * X(k, j);
+        }
+    for (size_t i = 0; i < 6; i++)
+        for (size_t j = 0; j < 6; j++) {
+            Xb(i, j) = 0;
+            for (size_t k = 0; k < 4; k++)
+                Xb(i, j) += X(i, k) * b(k, j);
+        }
+    for (size_t i = 0; i < 4; i++)
+        for (size_t j = 0; j < 6; j++) {
+            double r = 0, q = 0;
+            for (size_t k = 0; k < 4; k++)
+                r += bX(i, k) * b(k, j);
+            for (size_t k = 0; k < 6; k++)
+                q += Xb(j, k) * X(k, i);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, b(i, j), r);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, X(j, i), q);
+        }
+
+    // the rounds split over the threads give the same decomposition
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    setThreadCount(4);
+    pool.threshold = 0;
+    Vector<double> threaded;
+    rowMajorMatrix<double> Ut, Vt;
+    wide.compute(threaded, Ut, Vt, b, mode::full);
+    pool.threshold = threshold;
+    setThreadCount(1);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY(s.begin(), threaded.begin(), 4);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY(U.begin(), Ut.begin(), 16);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY(V.begin(), Vt.begin(), 36);
+
+    bool thrown = false;
+    try { wide.singularValues(s, a); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(test_expm);
+    RUN_TEST(test_vanLoan);
+    RUN_TEST(test_symEigen);
+    RUN_TEST(test_svd);
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
@@ -214,6 +214,221 @@ void test_sort(void) {
     TEST_ASSERT_EQUAL(5, v[4]);
 }
 
+// pseudo random values in [-range/2, range/2)
+template <typename T>
+void fillRandom(Vector<T> &v, const uint32_t range, uint32_t seed = 12345) {
+    for (size_t i = 0; i < v.size(); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        v[i] = T((int32_t)((seed >> 8) % range) - (int32_t)(range / 2));
+    }
+}
+
+template <typename T>
+bool isSorted(const Vector<T> &v, const bool ascending = true) {
+    for (size_t i = 1; i < v.size(); i++)
+        if (ascending ? v[i] < v[i - 1] : v[i - 1] < v[i])
+            return false;
+    return true;
+}
+
+void test_sort_large(void) {
+    Vector<float> v(1000);
+    fillRandom(v, 100);
+    Vector<float> ones(v.size());
+    ones.fill(1);
+    const double sum = v.dot(ones);
+    v.sort();
+    TEST_ASSERT_TRUE(isSorted(v));
+    TEST_ASSERT_EQUAL(sum, v.dot(ones));
+    v.sort(false);
+    TEST_ASSERT_TRUE(isSorted(v, false));
+    // already sorted and constant inputs
+    v.sort(false);
+    TEST_ASSERT_TRUE(isSorted(v, false));
+    v.fill(3);
+    v.sort();
+    TEST_ASSERT_EQUAL(3, v[999]);
+    Vector<float> empty;
+    empty.sort();
+    TEST_ASSERT_EQUAL(0, empty.size());
+}
+
+void test_radixSort(void) {
+    Vector<int16_t> i(500);
+    fillRandom(i, 60000);
+    i.radixSort();
+    TEST_ASSERT_TRUE(isSorted(i));
+    TEST_ASSERT_TRUE(i[0] < 0);
+    i.radixSort(false);
+    TEST_ASSERT_TRUE(isSorted(i, false));
+
+    Vector<double> d(500);
+    fillRandom(d, 1000);
+    d *= 0.37;
+    d[7] = -1e300;
+    d[8] = 1e-300;
+    d.radixSort();
+    TEST_ASSERT_TRUE(isSorted(d));
+    TEST_ASSERT_EQUAL(-1e300, d[0]);
+
+    Vector<uint8_t> u(300);
+    for (size_t k = 0; k < u.size(); k++)
+        u[k] = (k * 37) % 256;
+    u.radixSort();
+    TEST_ASSERT_TRUE(isSorted(u));
+    TEST_ASSERT_EQUAL(0, internal::tmp<Vector<uint8_t>>::currentlyUsedCount());
+}
+
+void test_argsort(void) {
+    Vector<double> v(6);
+    v[0] = 3; v[1] = 1; v[2] = 2; v[3] = 1; v[4] = 3; v[5] = 0;
+    Vector<size_t> indices;
+    v.argsort(indices);
+    TEST_ASSERT_EQUAL(6, indices.size());
+    const size_t expected[6] = {5, 1, 3, 2, 0, 4};
+    for (size_t i = 0; i < 6; i++)
+        TEST_ASSERT_EQUAL(expected[i], indices[i]);
+    v.argsort(indices, false);
+    const size_t expected_desc[6] = {0, 4, 2, 1, 3, 5};
+    for (size_t i = 0; i < 6; i++)
+        TEST_ASSERT_EQUAL(expected_desc[i], indices[i]);
+
+    Vector<float> w(200);
+    fillRandom(w, 20);
+    w.argsort(indices);
+    for (size_t i = 1; i < w.size(); i++)
+        TEST_ASSERT_TRUE(w[indices[i - 1]] < w[indices[i]] || (w[indices[i - 1]] == w[indices[i]] && indices[i - 1] < indices[i]));
+}
+
+void test_nthElement(void) {
+    Vector<float> v(1001);
+    fillRandom(v, 5000);
+    Vector<float> sorted(v);
+    sorted.sort();
+    v.nthElement(500);
+    TEST_ASSERT_EQUAL(sorted[500], v[500]);
+    for (size_t i = 0; i < 500; i++)
+        TEST_ASSERT_FALSE(v[500] < v[i]);
+    for (size_t i = 501; i < v.size(); i++)
+        TEST_ASSERT_FALSE(v[i] < v[500]);
+    v.nthElement(100, false);
+    TEST_ASSERT_EQUAL(sorted[900], v[100]);
+}
+
+void test_partialSort(void) {
+    Vector<float> v(300);
+    fillRandom(v, 1000);
+    Vector<float> sorted(v);
+    sorted.sort();
+    v.partialSort(20);
+    for (size_t i = 0; i < 20; i++)
+        TEST_ASSERT_EQUAL(sorted[i], v[i]);
+    v.partialSort(5, false);
+    for (size_t i = 0; i < 5; i++)
+        TEST_ASSERT_EQUAL(sorted[299 - i], v[i]);
+}
+
+void test_reductions(void) {
+    Vector<float> v(7);
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = (i % 2 ? -1.0f : 1.0f) * i;
+    v[5] = 6;
+    // 0 -1 2 -3 4 6 6
+    TEST_ASSERT_EQUAL(14, v.sum());
+    TEST_ASSERT_EQUAL(22, v.norm1());
+    TEST_ASSERT_EQUAL(102, v.norm2Squared());
+    TEST_ASSERT_FLOAT_WITHIN(1e-5, sqrt(102.0), v.norm2());
+    TEST_ASSERT_EQUAL(6, v.normInf());
+    TEST_ASSERT_EQUAL(-3, v.minimum());
+    TEST_ASSERT_EQUAL(3, v.argmin());
+    TEST_ASSERT_EQUAL(6, v.maximum());
+    TEST_ASSERT_EQUAL(5, v.argmax());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 2, v.mean());
+    TEST_ASSERT_FLOAT_WITHIN(1e-5, (102.0 - 7 * 4) / 7, v.variance());
+    TEST_ASSERT_FLOAT_WITHIN(1e-5, (102.0 - 7 * 4) / 6, v.variance(true));
+    Vector<float> prefix;
+    prefix.holdCumSum(v);
+    const float sums[] = {0, -1, 1, -2, 2, 8, 14};
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(sums, prefix.begin(), 7);
+    prefix.holdCumSum(prefix);
+    TEST_ASSERT_EQUAL(22, prefix[6]);
+
+    // the partial sums are accumulated in A
+    Vector<int8_t> c(100);
+    c.fill(100);
+    TEST_ASSERT_EQUAL(10000, c.sum());
+    TEST_ASSERT_EQUAL(100, c.mean());
+
+    Vector<float> empty;
+    TEST_ASSERT_EQUAL(0, empty.sum());
+    bool thrown = false;
+    try { empty.argmax(); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_elementwise(void) {
+    Vector<float> x(64);
+    for (size_t i = 0; i < x.size(); i++)
+        x[i] = 0.1f + 0.25f * i;
+    Vector<float> full, fast;
+    full.holdExp(x);
+    fast.holdExp(x, fastMath::accuracy::fast);
+    TEST_ASSERT_EQUAL(64, fast.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6 * full[i], full[i], fast[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, exp(x[i]), full[i]);
+    }
+    fast.holdLog(full, fastMath::accuracy::fast);
+    for (size_t i = 0; i < x.size(); i++)
+        TEST_ASSERT_FLOAT_WITHIN(2e-6 * x[i], x[i], fast[i]);
+    fast.holdSqrt(x, fastMath::accuracy::fast);
+    full.holdRsqrt(x);
+    for (size_t i = 0; i < x.size(); i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, sqrt(x[i]), fast[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, 1 / sqrt(x[i]), full[i]);
+    }
+    Vector<double> s, c, t, a;
+    Vector<double> xd;
+    xd.hold(x);
+    s.holdSin(xd, fastMath::accuracy::fast);
+    c.holdCos(xd);
+    t.holdTanh(xd, fastMath::accuracy::fast);
+    a.holdAtan2(s, c, fastMath::accuracy::fast);
+    for (size_t i = 0; i < x.size(); i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, sin(xd[i]), s[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, tanh(xd[i]), t[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-5, atan2(sin(xd[i]), cos(xd[i])), a[i]);
+    }
+    Vector<float> shorter(3);
+    bool thrown = false;
+    try { a.holdAtan2(s, shorter); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_normalize(void) {
+    Vector<float> q(4);
+    q[0] = 1; q[1] = 2; q[2] = -2; q[3] = 4;
+    q.normalize();
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, 0.2f, q[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, -0.4f, q[2]);
+    q *= 3.0f;
+    q.normalize(fastMath::accuracy::fast);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 1, q.norm2());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 0.8f, q[3]);
+    q.fill(0);
+    q.normalize();
+    TEST_ASSERT_EQUAL(0, q[0]);
+
+    // a double norm outside of the float range
+    Vector<double> tiny(2), huge(2);
+    tiny[0] = 3e-30; tiny[1] = 4e-30;
+    huge[0] = 3e30; huge[1] = -4e30;
+    tiny.normalize(fastMath::accuracy::fast);
+    huge.normalize(fastMath::accuracy::fast);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.6, tiny[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -0.8, huge[1]);
+}
+
 void test_fill(void) {
     Vector<double> v(5);
     v.fill(1);
@@ -667,6 +882,14 @@ void setup() {
     RUN_TEST(test_push_back);
     RUN_TEST(test_pop_back);
     RUN_TEST(test_sort);
+    RUN_TEST(test_sort_large);
+    RUN_TEST(test_radixSort);
+    RUN_TEST(test_argsort);
+    RUN_TEST(test_nthElement);
+    RUN_TEST(test_partialSort);
+    RUN_TEST(test_reductions);
+    RUN_TEST(test_elementwise);
+    RUN_TEST(test_normalize);
     RUN_TEST(test_fill);
     RUN_TEST(test_hold);
     RUN_TEST(test_holdAdd);
@@ -144,6 +144,115 @@ void test_expression(void) {
     TEST_ASSERT_EQUAL(4, m1(0,1));
     TEST_ASSERT_EQUAL(4, m1(1,0));
     TEST_ASSERT_EQUAL(3, m1(1,1));
+
+    // the temporary of m2*m3 goes back to the pool when it is multiplied by a symMatrix
+    symMatrix<int> s(2);
+    s.fill(1);
+    for (size_t i = 0; i < 3; i++)
+        m1 = m2*m3*s;
+    TEST_ASSERT_EQUAL(10, m1(0,0));
+    TEST_ASSERT_EQUAL(7, m1(1,1));
+    TEST_ASSERT_EQUAL(0, internal::tmp<rowMajorMatrix<int>>::currentlyUsedCount());
+}
+
+void test_accumulator(void) {
+    // 1e8 + 1 + ... + 1 - 1e8 : the ones are lost when accumulating in float
+    const size_t n = 10;
+    rowMajorMatrix<float> a(2, n + 2);
+    a.fill(1);
+    a(0, 0) = 1e8f;
+    a(0, n + 1) = -1e8f;
+    Vector<float> x(n + 2);
+    x.fill(1);
+
+    Vector<float> y;
+    y.holdMul(a, x);
+    TEST_ASSERT_EQUAL(0, y[0]);
+    TEST_ASSERT_EQUAL(n + 2, y[1]);
+    y.holdMul<float, float, double>(a, x);
+    TEST_ASSERT_EQUAL(n, y[0]);
+    TEST_ASSERT_EQUAL(n + 2, y[1]);
+
+    colMajorMatrix<float> b(n + 2, 1);
+    b.fill(1);
+    rowMajorMatrix<float> c;
+    c.holdMul<float, float, double>(a, b);
+    TEST_ASSERT_EQUAL(n, c(0, 0));
+    c.holdMul(a, b);
+    TEST_ASSERT_EQUAL(0, c(0, 0));
+}
+
+void test_reductions(void) {
+    rowMajorMatrix<float> a(2, 3);
+    colMajorMatrix<float> b(2, 3);
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 3; j++)
+            a(i, j) = b(i, j) = 10 * i + j;
+    Vector<float> r;
+    r.holdRowSum(a);
+    TEST_ASSERT_EQUAL(2, r.size());
+    TEST_ASSERT_EQUAL(3, r[0]);
+    TEST_ASSERT_EQUAL(33, r[1]);
+    r.holdRowSum(b);
+    TEST_ASSERT_EQUAL(3, r[0]);
+    TEST_ASSERT_EQUAL(33, r[1]);
+    r.holdColSum(a);
+    TEST_ASSERT_EQUAL(3, r.size());
+    TEST_ASSERT_EQUAL(10, r[0]);
+    TEST_ASSERT_EQUAL(14, r[2]);
+    r.holdColSum(b);
+    TEST_ASSERT_EQUAL(10, r[0]);
+    TEST_ASSERT_EQUAL(14, r[2]);
+
+    symMatrix<double> s(3);
+    double squares = 0;
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j <= i; j++)
+            s(i, j) = 1 + i + 2 * j;
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+            squares += s(i, j) * s(i, j);
+    TEST_ASSERT_EQUAL(1 + 4 + 7, s.trace());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, sqrt(squares), s.frobeniusNorm());
+
+    diagMatrix<float> d(3);
+    d.fill(2);
+    TEST_ASSERT_EQUAL(6, d.trace());
+    triangMatrix<float> t(3);
+    t.fill(1);
+    t(2, 2) = 5;
+    TEST_ASSERT_EQUAL(7, t.trace());
+    ul_triangMatrix<float> ul(4);
+    TEST_ASSERT_EQUAL(4, ul.trace());
+}
+
+void test_symMatrix_vector(void) {
+    symMatrix<double> s(3);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j <= i; j++)
+            s(i, j) = 1 + i + 2 * j;
+    Vector<double> x(3), y;
+    x[0] = 1;
+    x[1] = -2;
+    x[2] = 3;
+    y.holdMul(s, x);
+    for (size_t i = 0; i < 3; i++) {
+        double expected = 0;
+        for (size_t j = 0; j < 3; j++)
+            expected += s(i, j) * x[j];
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, expected, y[i]);
+    }
+    // s = 0.5 * s - 2 * x * x^T, in place
+    symMatrix<double> copy(s);
+    s.holdAddOuter(0.5, s, -2, x);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.5 * copy(i, j) - 2 * x[i] * x[j], s(i, j));
+    // the element-wise product of two symMatrix is not taken for the matrix-vector one
+    symMatrix<double> square(3);
+    square.holdMul(copy, copy);
+    for (size_t i = 0; i < 6; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, copy.begin()[i] * copy.begin()[i], square.begin()[i]);
 }
 
 void setUp() {
@@ -163,6 +272,9 @@ void setup() {
     RUN_TEST(test_rowMajor);
     RUN_TEST(test_tmp_rowMajor);
     RUN_TEST(test_expression);
+    RUN_TEST(test_accumulator);
+    RUN_TEST(test_reductions);
+    RUN_TEST(test_symMatrix_vector);
     UNITY_END();
 }
 
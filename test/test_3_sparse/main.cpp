@@ -0,0 +1,267 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <csrMatrix.hpp>
+#include <cscMatrix.hpp>
+using namespace operators;
+#ifdef NATIVE
+template <typename T>
+void print(const Vector<T> &v) {
+    std::cout << to_string(v) << std::endl;
+}
+#else
+template <typename T>
+void print(const Vector<T> &v) {
+    Serial.println(to_string(v).c_str());
+}
+#endif
+
+// 0 2 0 0
+// 1 0 0 3
+// 0 0 0 0
+rowMajorMatrix<int> dense34()
+{
+    rowMajorMatrix<int> m(3, 4);
+    m.fill(0);
+    m(0, 1) = 2;
+    m(1, 0) = 1;
+    m(1, 3) = 3;
+    return m;
+}
+
+void test_ctor_dtor(void) {
+    csrMatrix<double> m;
+    TEST_ASSERT_EQUAL(0, m.rows());
+    TEST_ASSERT_EQUAL(0, m.cols());
+    TEST_ASSERT_EQUAL(0, m.nonZeros());
+
+    csrMatrix<int> m1(3, 4);
+    TEST_ASSERT_EQUAL(3, m1.rows());
+    TEST_ASSERT_EQUAL(4, m1.cols());
+    TEST_ASSERT_EQUAL(0, m1.nonZeros());
+    const csrMatrix<int> &c1 = m1;
+    TEST_ASSERT_EQUAL(0, c1(2, 3));
+}
+
+void test_from_dense(void) {
+    csrMatrix<int> m(dense34());
+    TEST_ASSERT_EQUAL(3, m.rows());
+    TEST_ASSERT_EQUAL(4, m.cols());
+    TEST_ASSERT_EQUAL(3, m.nonZeros());
+    TEST_ASSERT_EQUAL(0, m.rowBegin(0));
+    TEST_ASSERT_EQUAL(1, m.rowBegin(1));
+    TEST_ASSERT_EQUAL(3, m.rowEnd(1));
+    TEST_ASSERT_EQUAL(3, m.rowEnd(2));
+    TEST_ASSERT_EQUAL(2, m(0, 1));
+    TEST_ASSERT_EQUAL(1, m(1, 0));
+    TEST_ASSERT_EQUAL(3, m(1, 3));
+    const csrMatrix<int> &c = m;
+    TEST_ASSERT_EQUAL(0, c(0, 0));
+    TEST_ASSERT_EQUAL(0, c(2, 2));
+
+    // the structure is fixed, writing a structural zero throws
+    bool thrown = false;
+    try { m(2, 2) = 1; } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+
+    rowMajorMatrix<float> d(2, 2);
+    d(0, 0) = 1e-4f; d(0, 1) = 1.0f;
+    d(1, 0) = -2.0f; d(1, 1) = -1e-4f;
+    csrMatrix<float> t(d, 1e-3f);
+    TEST_ASSERT_EQUAL(2, t.nonZeros());
+    TEST_ASSERT_EQUAL(1, t.colIndex(0));
+    TEST_ASSERT_EQUAL(0, t.colIndex(1));
+
+    cscMatrix<int> s(dense34());
+    TEST_ASSERT_EQUAL(3, s.nonZeros());
+    TEST_ASSERT_EQUAL(0, s.colBegin(0));
+    TEST_ASSERT_EQUAL(1, s.colBegin(1));
+    TEST_ASSERT_EQUAL(2, s.colEnd(2));
+    TEST_ASSERT_EQUAL(3, s.colEnd(3));
+    TEST_ASSERT_EQUAL(3, s(1, 3));
+
+    rowMajorMatrix<int> back;
+    back.hold(m);
+    TEST_ASSERT_EQUAL_INT_ARRAY(dense34().begin(), back.begin(), 12);
+    back.hold(s);
+    TEST_ASSERT_EQUAL_INT_ARRAY(dense34().begin(), back.begin(), 12);
+}
+
+void test_push_back(void) {
+    csrMatrix<int> m(3, 4);
+    m.push_back(0, 1, 2);
+    m.push_back(1, 0, 1);
+    m.push_back(1, 3, 3);
+    csrMatrix<int> ref(dense34());
+    TEST_ASSERT_EQUAL(ref.nonZeros(), m.nonZeros());
+    for (size_t i = 0; i < ref.rows(); i++)
+        TEST_ASSERT_EQUAL(ref.rowEnd(i), m.rowEnd(i));
+    TEST_ASSERT_EQUAL_INT_ARRAY(ref.begin(), m.begin(), 3);
+
+    bool thrown = false;
+    try { m.push_back(0, 3, 1); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+    thrown = false;
+    try { m.push_back(1, 2, 1); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+
+    cscMatrix<int> s(3, 4);
+    s.push_back(1, 0, 1);
+    s.push_back(0, 1, 2);
+    s.push_back(1, 3, 3);
+    TEST_ASSERT_EQUAL(3, s.nonZeros());
+    TEST_ASSERT_EQUAL(2, s(0, 1));
+    thrown = false;
+    try { s.push_back(0, 3, 1); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+
+    // skipped rows and columns, read while the matrix is still being built
+    csrMatrix<int> p(5, 4);
+    const csrMatrix<int> &cp = p;
+    p.push_back(1, 2, 4);
+    TEST_ASSERT_EQUAL(0, cp(0, 2));
+    TEST_ASSERT_EQUAL(4, cp(1, 2));
+    TEST_ASSERT_EQUAL(0, cp(4, 2));
+    TEST_ASSERT_EQUAL(1, p.rowBegin(2));
+    TEST_ASSERT_EQUAL(1, p.rowEnd(4));
+    p.push_back(3, 0, 5);
+    p.push_back(3, 3, 6);
+    rowMajorMatrix<int> dense(5, 4);
+    dense.hold(p);
+    const int expected[] = {0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 6, 0, 0, 0, 0};
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, dense.begin(), 20);
+    thrown = false;
+    try { p.push_back(2, 0, 1); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+    p.push_back(4, 1, 7);
+    TEST_ASSERT_EQUAL(7, p(4, 1));
+    TEST_ASSERT_EQUAL(4, p.rowEnd(4));
+
+    cscMatrix<int> q(4, 5);
+    q.push_back(2, 1, 4);
+    q.push_back(0, 3, 5);
+    q.push_back(3, 3, 6);
+    TEST_ASSERT_EQUAL(0, ((const cscMatrix<int> &)q)(2, 4));
+    TEST_ASSERT_EQUAL(3, q.colBegin(4));
+    dense.hold(q);
+    const int expectedT[] = {0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 6, 0};
+    TEST_ASSERT_EQUAL_INT_ARRAY(expectedT, dense.begin(), 20);
+}
+
+void test_vector(void) {
+    csrMatrix<int> a(dense34());
+    cscMatrix<int> b(dense34());
+    Vector<int> x(4);
+    x[0] = 1; x[1] = 2; x[2] = 3; x[3] = 4;
+    Vector<int> y;
+    y = a * x;
+    TEST_ASSERT_EQUAL(3, y.size());
+    TEST_ASSERT_EQUAL(4, y[0]);
+    TEST_ASSERT_EQUAL(13, y[1]);
+    TEST_ASSERT_EQUAL(0, y[2]);
+    y.addMul(a, x);
+    TEST_ASSERT_EQUAL(8, y[0]);
+    TEST_ASSERT_EQUAL(26, y[1]);
+    y = b * x;
+    TEST_ASSERT_EQUAL(4, y[0]);
+    TEST_ASSERT_EQUAL(13, y[1]);
+    TEST_ASSERT_EQUAL(0, y[2]);
+    TEST_ASSERT_EQUAL(0, internal::tmp<Vector<int>>::currentlyUsedCount());
+}
+
+void test_dense_product(void) {
+    const rowMajorMatrix<int> d = dense34();
+    csrMatrix<int> a(d);
+    rowMajorMatrix<int> b(4, 2);
+    for (size_t i = 0; i < b.size(); i++)
+        b[i] = i + 1;
+
+    rowMajorMatrix<int> ref;
+    ref.holdMul(d, b);
+    rowMajorMatrix<int> res;
+    res = a * b;
+    TEST_ASSERT_EQUAL(3, res.rows());
+    TEST_ASSERT_EQUAL(2, res.cols());
+    TEST_ASSERT_EQUAL_INT_ARRAY(ref.begin(), res.begin(), 6);
+
+    rowMajorMatrix<int> c(2, 3);
+    for (size_t i = 0; i < c.size(); i++)
+        c[i] = i + 1;
+    cscMatrix<int> s(d);
+    ref.holdMul(c, d);
+    res = c * s;
+    TEST_ASSERT_EQUAL(2, res.rows());
+    TEST_ASSERT_EQUAL(4, res.cols());
+    TEST_ASSERT_EQUAL_INT_ARRAY(ref.begin(), res.begin(), 8);
+}
+
+void test_sandwich(void) {
+    const rowMajorMatrix<int> d = dense34();
+    csrMatrix<int> a(d);
+    symMatrix<int> p(4);
+    for (size_t i = 0; i < p.size(); i++)
+        p[i] = i + 1;
+
+    // reference : d * p * d^T computed densely
+    rowMajorMatrix<int> dp, dpdt(3, 3);
+    dp.holdMul(d, p);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+        {
+            int sum = 0;
+            for (size_t k = 0; k < 4; k++)
+                sum += dp(i, k) * d(j, k);
+            dpdt(i, j) = sum;
+        }
+
+    symMatrix<int> s;
+    s.holdSandwich(a, p);
+    TEST_ASSERT_EQUAL(3, s.rows());
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_EQUAL(dpdt(i, j), s(i, j));
+
+    s.addSandwich(a, p);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_EQUAL(2 * dpdt(i, j), s(i, j));
+
+    bool thrown = false;
+    try { p.holdSandwich(a, p); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    // Ajoute d'autres tests ici.
+    RUN_TEST(test_ctor_dtor);
+    RUN_TEST(test_from_dense);
+    RUN_TEST(test_push_back);
+    RUN_TEST(test_vector);
+    RUN_TEST(test_dense_product);
+    RUN_TEST(test_sandwich);
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
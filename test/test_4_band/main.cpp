@@ -0,0 +1,275 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <bandMatrix.hpp>
+#include <blockDiagMatrix.hpp>
+using namespace operators;
+#ifdef NATIVE
+template <typename T>
+void print(const Vector<T> &v) {
+    std::cout << to_string(v) << std::endl;
+}
+#else
+template <typename T>
+void print(const Vector<T> &v) {
+    Serial.println(to_string(v).c_str());
+}
+#endif
+
+template <typename T>
+rowMajorMatrix<T> dense(const MatrixBase<T> &m)
+{
+    rowMajorMatrix<T> d(m.rows(), m.cols());
+    for (size_t i = 0; i < m.rows(); i++)
+        for (size_t j = 0; j < m.cols(); j++)
+            d(i, j) = m(i, j);
+    return d;
+}
+
+// symmetric positive definite tridiagonal (band = 1) or pentadiagonal (band = 2) matrix
+bandMatrix<double> spdBand(const size_t n, const size_t band)
+{
+    rowMajorMatrix<double> d(n, n);
+    d.fill(0);
+    for (size_t i = 0; i < n; i++)
+    {
+        d(i, i) = 4 + i;
+        for (size_t k = 1; k <= band && i + k < n; k++)
+            d(i, i + k) = d(i + k, i) = 1.0 / (k + i);
+    }
+    bandMatrix<double> b(n, band);
+    b.hold(d);
+    return b;
+}
+
+void test_band_ctor(void) {
+    bandMatrix<int> m;
+    TEST_ASSERT_EQUAL(0, m.rows());
+    TEST_ASSERT_EQUAL(0, m.size());
+
+    bandMatrix<int> m1(5, 4, 1, 2);
+    TEST_ASSERT_EQUAL(5, m1.rows());
+    TEST_ASSERT_EQUAL(4, m1.cols());
+    TEST_ASSERT_EQUAL(1, m1.lowerBandwidth());
+    TEST_ASSERT_EQUAL(2, m1.upperBandwidth());
+    TEST_ASSERT_EQUAL(20, m1.size());
+    TEST_ASSERT_TRUE(m1.inBand(1, 0));
+    TEST_ASSERT_TRUE(m1.inBand(1, 3));
+    TEST_ASSERT_FALSE(m1.inBand(2, 0));
+    TEST_ASSERT_FALSE(m1.inBand(0, 3));
+
+    m1.fill(1);
+    m1(1, 3) = 7;
+    const bandMatrix<int> &c = m1;
+    TEST_ASSERT_EQUAL(7, c(1, 3));
+    TEST_ASSERT_EQUAL(0, c(3, 0));
+    bool thrown = false;
+    try { m1(3, 0) = 1; } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_band_products(void) {
+    rowMajorMatrix<int> d(5, 4);
+    for (size_t i = 0; i < d.size(); i++)
+        d[i] = i + 1;
+    bandMatrix<int> a(5, 4, 1, 2);
+    a.hold(d);
+    // the elements outside the band are ignored
+    rowMajorMatrix<int> ref = dense<int>(a);
+    TEST_ASSERT_EQUAL(0, ref(0, 3));
+    TEST_ASSERT_EQUAL(0, ref(4, 0));
+    TEST_ASSERT_EQUAL(d(4, 3), ref(4, 3));
+
+    Vector<int> x(4);
+    x[0] = 1; x[1] = -2; x[2] = 3; x[3] = 5;
+    Vector<int> y, yref;
+    y = a * x;
+    yref.holdMul(ref, x);
+    TEST_ASSERT_EQUAL(5, y.size());
+    TEST_ASSERT_EQUAL_INT_ARRAY(yref.begin(), y.begin(), 5);
+
+    rowMajorMatrix<int> b(4, 3);
+    for (size_t i = 0; i < b.size(); i++)
+        b[i] = (int)i - 4;
+    rowMajorMatrix<int> res, resref;
+    res = a * b;
+    resref.holdMul(ref, b);
+    TEST_ASSERT_EQUAL(5, res.rows());
+    TEST_ASSERT_EQUAL(3, res.cols());
+    TEST_ASSERT_EQUAL_INT_ARRAY(resref.begin(), res.begin(), 15);
+
+    rowMajorMatrix<int> c(2, 5);
+    for (size_t i = 0; i < c.size(); i++)
+        c[i] = 2 * (int)i - 3;
+    res = c * a;
+    resref.holdMul(c, ref);
+    TEST_ASSERT_EQUAL(2, res.rows());
+    TEST_ASSERT_EQUAL(4, res.cols());
+    TEST_ASSERT_EQUAL_INT_ARRAY(resref.begin(), res.begin(), 8);
+}
+
+void test_band_ldl(void) {
+    for (size_t band = 1; band <= 2; band++)
+    {
+        const size_t n = 7;
+        bandMatrix<double> a = spdBand(n, band);
+        bandMatrix<double> f;
+        f.holdLDL(a);
+        TEST_ASSERT_EQUAL(band, f.lowerBandwidth());
+        TEST_ASSERT_EQUAL(0, f.upperBandwidth());
+        // storage in O(n*b)
+        TEST_ASSERT_EQUAL(n * (band + 1), f.size());
+
+        Vector<double> b(n);
+        for (size_t i = 0; i < n; i++)
+            b[i] = 1.0 + i;
+        Vector<double> x;
+        x.holdSolveLDL(f, b);
+        Vector<double> ax;
+        ax.holdMul(a, x);
+        for (size_t i = 0; i < n; i++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, b[i], ax[i]);
+    }
+}
+
+void test_blockDiag_ctor(void) {
+    blockDiagMatrix<int> m;
+    TEST_ASSERT_EQUAL(0, m.rows());
+    TEST_ASSERT_EQUAL(0, m.blocks());
+
+    rowMajorMatrix<int> d(2, 2);
+    d(0, 0) = 1; d(0, 1) = 2; d(1, 0) = 3; d(1, 1) = 4;
+    symMatrix<int> s(3);
+    for (size_t i = 0; i < s.size(); i++)
+        s[i] = i + 1;
+    m.addBlock(d);
+    m.addBlock(s);
+    m.addBlock(1);
+    TEST_ASSERT_EQUAL(3, m.blocks());
+    TEST_ASSERT_EQUAL(6, m.rows());
+    TEST_ASSERT_EQUAL(6, m.cols());
+    TEST_ASSERT_EQUAL(4 + 6 + 1, m.size());
+    TEST_ASSERT_EQUAL(2, m.blockStart(1));
+    TEST_ASSERT_EQUAL(3, m.blockOrder(1));
+    TEST_ASSERT_FALSE(m.isSymmetric(0));
+    TEST_ASSERT_TRUE(m.isSymmetric(1));
+
+    const blockDiagMatrix<int> &c = m;
+    TEST_ASSERT_EQUAL(3, c(1, 0));
+    TEST_ASSERT_EQUAL(2, c(0, 1));
+    TEST_ASSERT_EQUAL(s(2, 1), c(4, 3));
+    TEST_ASSERT_EQUAL(s(1, 2), c(3, 4));
+    TEST_ASSERT_EQUAL(0, c(5, 5));
+    TEST_ASSERT_EQUAL(0, c(1, 2));
+    TEST_ASSERT_EQUAL(0, c(5, 0));
+    bool thrown = false;
+    try { m(0, 4) = 1; } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_blockDiag_products(void) {
+    rowMajorMatrix<int> d(2, 2);
+    d(0, 0) = 1; d(0, 1) = 2; d(1, 0) = 3; d(1, 1) = 4;
+    symMatrix<int> s(3);
+    for (size_t i = 0; i < s.size(); i++)
+        s[i] = i + 1;
+    blockDiagMatrix<int> a;
+    a.addBlock(s);
+    a.addBlock(d);
+    rowMajorMatrix<int> ref = dense<int>(a);
+
+    Vector<int> x(5);
+    for (size_t i = 0; i < 5; i++)
+        x[i] = 2 * (int)i - 3;
+    Vector<int> y, yref;
+    y = a * x;
+    yref.holdMul(ref, x);
+    TEST_ASSERT_EQUAL_INT_ARRAY(yref.begin(), y.begin(), 5);
+
+    rowMajorMatrix<int> b(5, 2);
+    for (size_t i = 0; i < b.size(); i++)
+        b[i] = (int)i - 4;
+    rowMajorMatrix<int> res, resref;
+    res = a * b;
+    resref.holdMul(ref, b);
+    TEST_ASSERT_EQUAL_INT_ARRAY(resref.begin(), res.begin(), 10);
+
+    rowMajorMatrix<int> c(3, 5);
+    for (size_t i = 0; i < c.size(); i++)
+        c[i] = 3 - (int)i;
+    res = c * a;
+    resref.holdMul(c, ref);
+    TEST_ASSERT_EQUAL(3, res.rows());
+    TEST_ASSERT_EQUAL(5, res.cols());
+    TEST_ASSERT_EQUAL_INT_ARRAY(resref.begin(), res.begin(), 15);
+}
+
+void test_blockDiag_ldl(void) {
+    symMatrix<double> s(3);
+    s(0, 0) = 4; s(1, 0) = 1; s(1, 1) = 5; s(2, 0) = 0.5; s(2, 1) = -1; s(2, 2) = 6;
+    rowMajorMatrix<double> d(2, 2);
+    d(0, 0) = 3; d(0, 1) = 1; d(1, 0) = 1; d(1, 1) = 2;
+    blockDiagMatrix<double> a;
+    a.addBlock(s);
+    a.addBlock(d);
+
+    blockDiagMatrix<double> f;
+    f.holdLDL(a);
+    TEST_ASSERT_EQUAL(2, f.blocks());
+    TEST_ASSERT_TRUE(f.isSymmetric(1));
+    TEST_ASSERT_EQUAL(6 + 3, f.size());
+
+    Vector<double> b(5);
+    for (size_t i = 0; i < 5; i++)
+        b[i] = 1.0 + i;
+    Vector<double> x, ax;
+    x.holdSolveLDL(f, b);
+    ax.holdMul(a, x);
+    for (size_t i = 0; i < 5; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, b[i], ax[i]);
+
+    // in place, only for packed blocks
+    blockDiagMatrix<double> g;
+    g.addBlock(s);
+    g.holdLDL(g);
+    for (size_t i = 0; i < g.size(); i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, f[i], g[i]);
+    bool thrown = false;
+    try { a.holdLDL(a); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    // Ajoute d'autres tests ici.
+    RUN_TEST(test_band_ctor);
+    RUN_TEST(test_band_products);
+    RUN_TEST(test_band_ldl);
+    RUN_TEST(test_blockDiag_ctor);
+    RUN_TEST(test_blockDiag_products);
+    RUN_TEST(test_blockDiag_ldl);
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
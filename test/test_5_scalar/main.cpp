@@ -0,0 +1,429 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <linearAlgebra.hpp>
+using namespace operators;
+
+void test_q15_arithmetic(void) {
+    q15 a = 0.5, b = 0.25;
+    TEST_ASSERT_EQUAL(16384, a.raw);
+    TEST_ASSERT_EQUAL(0, q15().raw);
+    TEST_ASSERT_EQUAL_FLOAT(0.75, (float)(a + b));
+    TEST_ASSERT_EQUAL_FLOAT(0.25, (float)(a - b));
+    TEST_ASSERT_EQUAL_FLOAT(0.125, (float)(q15)(a * b));
+    TEST_ASSERT_EQUAL_FLOAT(0.5, (float)(b / a));
+
+    // saturation
+    TEST_ASSERT_EQUAL(INT16_MAX, q15(1).raw);
+    TEST_ASSERT_EQUAL(INT16_MIN, q15(-3.0).raw);
+    TEST_ASSERT_EQUAL(INT16_MAX, (a + a + a).raw);
+    TEST_ASSERT_EQUAL(INT16_MIN, (-a - a - a).raw);
+    TEST_ASSERT_EQUAL(INT16_MAX, (-q15(-1)).raw);
+    TEST_ASSERT_EQUAL(INT16_MAX, (a / b).raw);
+    TEST_ASSERT_EQUAL(INT16_MIN, (-a / q15()).raw);
+    q15 c = q15(-1) * q15(-1);
+    TEST_ASSERT_EQUAL(INT16_MAX, c.raw);
+
+    // rounding to nearest
+    q15 lsb = q15::fromRaw(1);
+    TEST_ASSERT_EQUAL(0, ((q15)(lsb * q15(0.49))).raw);
+    TEST_ASSERT_EQUAL(1, ((q15)(lsb * q15(0.51))).raw);
+    TEST_ASSERT_EQUAL(-1, ((q15)(-lsb * q15(0.51))).raw);
+
+    TEST_ASSERT_TRUE(b < a);
+    TEST_ASSERT_TRUE(a > 0);
+}
+
+void test_q31_arithmetic(void) {
+    q31 a = 0.5, b = 0.25;
+    TEST_ASSERT_EQUAL(1073741824, a.raw);
+    TEST_ASSERT_EQUAL_DOUBLE(0.75, (double)(a + b));
+    TEST_ASSERT_EQUAL_DOUBLE(0.125, (double)(q31)(a * b));
+    TEST_ASSERT_EQUAL_DOUBLE(0.5, (double)(b / a));
+    TEST_ASSERT_EQUAL(INT32_MAX, (a + a + a).raw);
+    TEST_ASSERT_EQUAL(INT32_MIN, (-a - a - a).raw);
+    TEST_ASSERT_EQUAL(INT32_MAX, ((q31)(q31(-1) * q31(-1))).raw);
+
+    q31_acc acc = a * b;
+    acc += a * a;
+    TEST_ASSERT_EQUAL_DOUBLE(0.375, (double)acc);
+    TEST_ASSERT_EQUAL_DOUBLE(0.75, (double)(acc / a));
+    TEST_ASSERT_EQUAL(INT32_MAX, (acc / q31::fromRaw(1)).raw);
+}
+
+void test_q15_dot(void) {
+    // 64 products of 0.5*0.5 overflow the q15 range but not the accumulator
+    Vector<q15> x(64), y(64);
+    x.fill(0.5);
+    y.fill(-0.25);
+    q15_acc acc = x.dot(y);
+    TEST_ASSERT_EQUAL_FLOAT(-8, (float)acc);
+    TEST_ASSERT_EQUAL(INT16_MIN, ((q15)acc).raw);
+
+    // the products are not rounded before being summed
+    Vector<q15> lsb(100), half(100);
+    lsb.fill(q15::fromRaw(1));
+    half.fill(0.5);
+    TEST_ASSERT_EQUAL(50, ((q15)lsb.dot(half)).raw);
+}
+
+void test_q15_matrix(void) {
+    const size_t n = 8;
+    rowMajorMatrix<float> af(n, n);
+    rowMajorMatrix<q15> aq(n, n);
+    Vector<float> xf(n);
+    Vector<q15> xq(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        xq[i] = xf[i] = 0.9f * ((float)i / n - 0.5f);
+        for (size_t j = 0; j < n; j++)
+            aq(i, j) = af(i, j) = 0.2f * ((float)((i * 7 + j * 3) % 11) / 11 - 0.5f);
+    }
+    Vector<float> yf(n);
+    Vector<q15> yq(n);
+    yf.holdMul(af, xf);
+    yq.holdMul(aq, xq);
+    for (size_t i = 0; i < n; i++)
+        TEST_ASSERT_FLOAT_WITHIN(4.0f / 32768, yf[i], (float)yq[i]);
+
+    // the operators store the result as q15
+    Vector<q15> y2 = aq * xq;
+    rowMajorMatrix<q15> a2 = aq * aq;
+    rowMajorMatrix<float> a2f = af * af;
+    for (size_t i = 0; i < n; i++)
+    {
+        TEST_ASSERT_EQUAL(yq[i].raw, y2[i].raw);
+        for (size_t j = 0; j < n; j++)
+            TEST_ASSERT_FLOAT_WITHIN(4.0f / 32768, a2f(i, j), (float)a2(i, j));
+    }
+
+    rowMajorMatrix<q31> a31(n, n);
+    Vector<q31> x31(n), y31(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        x31[i] = (double)xf[i];
+        for (size_t j = 0; j < n; j++)
+            a31(i, j) = (double)af(i, j);
+    }
+    y31.holdMul(a31, x31);
+    for (size_t i = 0; i < n; i++)
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, yf[i], (double)y31[i]);
+
+    // along the storage, the partial sums overflow a q15 but not its accumulator : 0.6 + 0.6 - 0.6
+    rowMajorMatrix<q15> f(3, 20);
+    colMajorMatrix<q15> g(20, 3);
+    for (size_t j = 0; j < 20; j++)
+        for (size_t i = 0; i < 3; i++)
+            f(i, j) = g(j, i) = q15(i < 2 ? 0.6 : -0.6);
+    Vector<q15> q;
+    q.holdColSum(f);
+    TEST_ASSERT_EQUAL(20, q.size());
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 0.6f, (float)q[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 0.6f, (float)q[19]);
+    q.holdRowSum(g);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 0.6f, (float)q[17]);
+}
+
+void test_fixed_point_ldl(void) {
+    const size_t n = 5;
+    symMatrix<float> pf(n, n);
+    ldl_matrix<float> lf(n);
+    ldl_matrix<q15> lq(n);
+    ldl_matrix<q31> l31(n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++)
+        {
+            const float v = i == j ? 0.5f + 0.05f * i : 0.02f * (i + j) / n;
+            pf(i, j) = lf(i, j) = v;
+            lq(i, j) = v;
+            l31(i, j) = (double)v;
+        }
+    lf.decompose();
+    lq.decompose();
+    l31.decompose();
+    for (size_t i = 0; i < n; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(4.0f / 32768, lf.D(i, i), (float)lq.D(i, i));
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, lf.D(i, i), (double)l31.D(i, i));
+        for (size_t j = 0; j < i; j++)
+        {
+            TEST_ASSERT_FLOAT_WITHIN(8.0f / 32768, lf.L(i, j), (float)lq.L(i, j));
+            TEST_ASSERT_FLOAT_WITHIN(1e-6, lf.L(i, j), (double)l31.L(i, j));
+        }
+    }
+
+    // packed symmetric product A P At
+    rowMajorMatrix<q15> a(n, n);
+    rowMajorMatrix<float> af(n, n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            a(i, j) = af(i, j) = i == j ? 0.9f : (j == i + 1 ? 0.05f : 0.0f);
+    csrMatrix<q15> aq(a);
+    csrMatrix<float> acf(af);
+    symMatrix<q15> pq(n, n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++)
+            pq(i, j) = pf(i, j);
+    symMatrix<q15> sq(n, n);
+    symMatrix<float> sf(n, n);
+    sq.holdSandwich(aq, pq);
+    sf.holdSandwich(acf, pf);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_FLOAT_WITHIN(8.0f / 32768, sf(i, j), (float)sq(i, j));
+}
+
+void test_half_conversion(void) {
+    TEST_ASSERT_EQUAL(2, sizeof(half));
+    TEST_ASSERT_EQUAL(0x3C00, half(1.0f).raw);
+    TEST_ASSERT_EQUAL(0xC000, half(-2.0f).raw);
+    TEST_ASSERT_EQUAL(0x7BFF, half(65504.0f).raw);
+    TEST_ASSERT_EQUAL(0x7C00, half(65520.0f).raw);
+    TEST_ASSERT_EQUAL(0xFC00, half(-1e10f).raw);
+    TEST_ASSERT_EQUAL(0x0001, half(5.9604645e-8f).raw);
+    TEST_ASSERT_EQUAL(0x0000, half(2.9802322e-8f).raw); // 2^-25, ties to even
+    TEST_ASSERT_EQUAL(0x0400, half(6.1035156e-5f).raw);
+    TEST_ASSERT_EQUAL(0, half().raw);
+    // 1 + 2^-11 is halfway between 1 and 1 + 2^-10 : ties to even
+    TEST_ASSERT_EQUAL(0x3C00, half(1.0f + 1.0f / 2048).raw);
+    TEST_ASSERT_EQUAL(0x3C02, half(1.0f + 3.0f / 2048).raw);
+    TEST_ASSERT_TRUE(std::isnan((float)half(NAN)));
+    TEST_ASSERT_TRUE(std::isinf((float)half::fromRaw(0x7C00)));
+
+    // every finite half goes back to itself through float
+    for (uint32_t raw = 0; raw < 0x10000; raw++)
+        if ((raw & 0x7C00) != 0x7C00 && half((float)half::fromRaw(raw)).raw != raw)
+            TEST_ASSERT_EQUAL(raw, half((float)half::fromRaw(raw)).raw);
+
+    TEST_ASSERT_EQUAL(2, sizeof(bfloat16));
+    TEST_ASSERT_EQUAL(0x3F80, bfloat16(1.0f).raw);
+    TEST_ASSERT_EQUAL(0x3F80, bfloat16(1.0f + 1.0f / 256).raw);
+    TEST_ASSERT_EQUAL(0x3F82, bfloat16(1.0f + 3.0f / 256).raw);
+    TEST_ASSERT_EQUAL_FLOAT(-3.0f, (float)bfloat16(-3.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e28f, 1e30f, (float)bfloat16(1e30f));
+    TEST_ASSERT_TRUE(std::isnan((float)bfloat16(NAN)));
+}
+
+void test_half_storage(void) {
+    const size_t n = 16;
+    rowMajorMatrix<half> ah(n, n);
+    rowMajorMatrix<bfloat16> ab(n, n);
+    rowMajorMatrix<float> af(n, n);
+    Vector<half> xh(n);
+    Vector<float> xf(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        xh[i] = 0.1f * i - 0.7f;
+        xf[i] = xh[i];
+        for (size_t j = 0; j < n; j++)
+        {
+            ah(i, j) = 1.0f / (1 + i + 2 * j);
+            ab(i, j) = (float)ah(i, j);
+            af(i, j) = ah(i, j);
+        }
+    }
+    TEST_ASSERT_EQUAL(n * n * 2, ah.size() * sizeof(half));
+
+    // the products are computed with the stored values converted to float
+    Vector<float> yf(n), yh(n), yb(n);
+    yf.holdMul(af, xf);
+    yh.holdMul(ah, xh);
+    yb.holdMul(ab, xf);
+    Vector<double> yd(n);
+    yd.holdMul<half, half, double>(ah, xh);
+    for (size_t i = 0; i < n; i++)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(yf[i], yh[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, yf[i], yd[i]);
+        TEST_ASSERT_FLOAT_WITHIN(2e-2, yf[i], yb[i]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(xf.dot(xf), xh.dot(xh));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, xf.dot(xf), (xh.dot<half, double>(xh)));
+
+    // the operators store the result as half
+    Vector<half> y2 = ah * xh;
+    for (size_t i = 0; i < n; i++)
+        TEST_ASSERT_EQUAL(half(yf[i]).raw, y2[i].raw);
+    Vector<half> s(n);
+    s.holdAdd(xh, xh);
+    s += xh;
+    for (size_t i = 0; i < n; i++)
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, 3 * xf[i], (float)s[i]);
+}
+
+// distance in ulp between two floats of the same sign
+int64_t ulpDistance(const float a, const float b) {
+    int64_t d = (int64_t)internal::floatBits(a) - (int64_t)internal::floatBits(b);
+    return d < 0 ? -d : d;
+}
+
+void test_fastMath(void) {
+    // sampled against the double libm, within the bounds documented in fastMath.hpp
+    int64_t rsqrt = 0, sqrt = 0, exp = 0, log = 0, sin = 0, tanh = 0, atan2 = 0;
+    for (float x = 1e-3f; x < 1e4f; x *= 1.0137f) {
+        rsqrt = std::max(rsqrt, ulpDistance(fastMath::rsqrt(x), (float)(1 / ::sqrt((double)x))));
+        sqrt = std::max(sqrt, ulpDistance(fastMath::sqrt(x), (float)::sqrt((double)x)));
+        log = std::max(log, ulpDistance(fastMath::log(x), (float)::log((double)x)) * (x > 1.1f || x < 0.9f));
+        atan2 = std::max(atan2, ulpDistance(fastMath::atan2(x, 1.5f), (float)::atan2((double)x, 1.5)));
+        atan2 = std::max(atan2, ulpDistance(fastMath::atan2(-x, -1.5f), (float)::atan2(-(double)x, -1.5)));
+    }
+    for (float x = -80; x < 80; x += 0.0173f) {
+        exp = std::max(exp, ulpDistance(fastMath::exp(x), (float)::exp((double)x)));
+        tanh = std::max(tanh, ulpDistance(fastMath::tanh(x), (float)::tanh((double)x)));
+    }
+    for (float x = 0.001f; x < 3.14f; x += 0.00137f) {
+        sin = std::max(sin, ulpDistance(fastMath::sin(x), (float)::sin((double)x)));
+        sin = std::max(sin, ulpDistance(fastMath::cos(x * 0.5f), (float)::cos((double)(x * 0.5f))));
+        TEST_ASSERT_FLOAT_WITHIN(1e-7, ::sin((double)(1000.0f + x)), fastMath::sin(1000.0f + x));
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(3, rsqrt);
+    TEST_ASSERT_LESS_OR_EQUAL(1, sqrt);
+    TEST_ASSERT_LESS_OR_EQUAL(1, exp);
+    TEST_ASSERT_LESS_OR_EQUAL(1, log);
+    TEST_ASSERT_LESS_OR_EQUAL(1, sin);
+    TEST_ASSERT_LESS_OR_EQUAL(1, tanh);
+    TEST_ASSERT_LESS_OR_EQUAL(4, atan2);
+
+    TEST_ASSERT_EQUAL(0, fastMath::exp(-200));
+    TEST_ASSERT_TRUE(isinf(fastMath::exp(100)));
+    TEST_ASSERT_TRUE(isnan(fastMath::exp(NAN)));
+    TEST_ASSERT_TRUE(isinf(fastMath::log(0)));
+    TEST_ASSERT_TRUE(isnan(fastMath::log(-1)));
+    TEST_ASSERT_EQUAL_FLOAT(fastMath::pi, fastMath::atan2(0.0f, -1.0f));
+    TEST_ASSERT_EQUAL_FLOAT(-0.5f * fastMath::pi, fastMath::atan2(-1.0f, 0.0f));
+
+    // subnormals, infinities and the arguments beyond the reduction of sin and cos
+    for (float x = 1.4e-45f; x < 1.2e-38f; x = x * 1.37f + 1.4e-45f) {
+        TEST_ASSERT_LESS_OR_EQUAL(3, ulpDistance(fastMath::rsqrt(x), (float)(1 / ::sqrt((double)x))));
+        TEST_ASSERT_LESS_OR_EQUAL(1, ulpDistance(fastMath::sqrt(x), (float)::sqrt((double)x)));
+    }
+    TEST_ASSERT_EQUAL(0, fastMath::rsqrt(INFINITY));
+    TEST_ASSERT_TRUE(isinf(fastMath::rsqrt(0.0f)) && isnan(fastMath::rsqrt(-1.0f)) && isnan(fastMath::rsqrt(NAN)));
+    TEST_ASSERT_TRUE(isinf(fastMath::sqrt(INFINITY)));
+    TEST_ASSERT_LESS_OR_EQUAL(1, ulpDistance(fastMath::sqrt(3.40282347e38f), (float)::sqrt(3.40282347e38)));
+    TEST_ASSERT_TRUE(isnan(fastMath::sin(INFINITY)) && isnan(fastMath::cos(-INFINITY)) && isnan(fastMath::sin(NAN)) && isnan(fastMath::cos(NAN)));
+    TEST_ASSERT_EQUAL_FLOAT(::sinf(1e10f), fastMath::sin(1e10f));
+    TEST_ASSERT_EQUAL_FLOAT(::cosf(-3e38f), fastMath::cos(-3e38f));
+}
+
+void test_dual_arithmetic(void) {
+    // every rule against its analytic derivative at x = 0.7, y = 1.3
+    typedef dual<double> D;
+    const double x0 = 0.7, y0 = 1.3;
+    const D x = D::variable(x0, 0), y(y0);
+    TEST_ASSERT_EQUAL_DOUBLE(2 * x0 * y0 + 1, (x * x * y + x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(-y0 / (x0 * x0), (y / x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1 / y0, (x / y).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(-3, (2.0 - 3.0 * x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(-1 / (x0 * x0), (1.0 / x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(0.5 / ::sqrt(x0), sqrt(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(::exp(2 * x0) * 2, exp(2.0 * x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1 / x0, log(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(::cos(x0), sin(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(-::sin(x0), cos(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1 / (::cos(x0) * ::cos(x0)), tan(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1 - ::tanh(x0) * ::tanh(x0), tanh(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1 / (1 + x0 * x0), atan(x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(2.5 * ::pow(x0, 1.5), pow(x, 2.5).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(0, pow(D(0), 0.5).value);
+    TEST_ASSERT_EQUAL_DOUBLE(1, pow(D(0), 0.0).value);
+    TEST_ASSERT_EQUAL_DOUBLE(0, pow(D::variable(0, 0), 0.0).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(1, fabs(-x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(-y0 / (x0 * x0 + y0 * y0), atan2(y, x).d[0]);
+    TEST_ASSERT_EQUAL_DOUBLE(::atan2(y0, x0), atan2(y, x).value);
+    TEST_ASSERT_TRUE(x < y && y > x && x != y && x == D(x0));
+
+    // the directions stay independent, and a dualN goes through the matrix kernels as a scalar
+    typedef dualN<float, 3> D3;
+    Vector<D3> v(3);
+    for (size_t i = 0; i < 3; i++)
+        v[i] = D3::variable(i + 1.0f, i);
+    D3 n = v.norm2();
+    for (size_t i = 0; i < 3; i++)
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, (i + 1.0f) / ::sqrtf(14), n.d[i]);
+    rowMajorMatrix<D3> A(2, 3);
+    for (size_t i = 0; i < 6; i++)
+        A.begin()[i] = D3(float(i));
+    Vector<D3> Av(2);
+    Av.holdMul(A, v);
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 3; j++)
+            TEST_ASSERT_EQUAL_FLOAT(A(i, j).value, Av[i].d[j]);
+}
+
+// y = [x0 * x1 - sin(x2), exp(x3) / x4, x0 + x4^2]
+template <typename T>
+void model(Vector<T> &y, const Vector<T> &x) {
+    y[0] = x.begin()[0] * x.begin()[1] - sin(x.begin()[2]);
+    y[1] = exp(x.begin()[3]) / x.begin()[4];
+    y[2] = x.begin()[0] + x.begin()[4] * x.begin()[4];
+}
+
+template <size_t W>
+void checkJacobian(const Vector<double> &x) {
+    const double *p = x.begin();
+    const double expected[3][5] = {{p[1], p[0], -::cos(p[2]), 0, 0},
+                                   {0, 0, 0, ::exp(p[3]) / p[4], -::exp(p[3]) / (p[4] * p[4])},
+                                   {1, 0, 0, 0, 2 * p[4]}};
+    rowMajorMatrix<double> J(3, 1);
+    Vector<double> y;
+    auto f = [](Vector<dualN<double, W>> &y, const Vector<dualN<double, W>> &x) { model(y, x); };
+    TEST_ASSERT_TRUE(jacobian<W>(f, x, J, &y) == &J);
+    TEST_ASSERT_EQUAL(3, J.rows());
+    TEST_ASSERT_EQUAL(5, J.cols());
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 5; j++)
+            TEST_ASSERT_EQUAL_DOUBLE(expected[i][j], J(i, j));
+    Vector<double> reference(3);
+    model(reference, x);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(reference.begin(), y.begin(), 3);
+}
+
+void test_jacobian(void) {
+    // widths 1, 3 (a partial last pass) and 8 (a single pass) give the same exact jacobian
+    Vector<double> x(5);
+    for (size_t i = 0; i < 5; i++)
+        x[i] = 0.3 * i + 0.5;
+    checkJacobian<1>(x);
+    checkJacobian<3>(x);
+    checkJacobian<8>(x);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    // Ajoute d'autres tests ici.
+    RUN_TEST(test_q15_arithmetic);
+    RUN_TEST(test_q31_arithmetic);
+    RUN_TEST(test_q15_dot);
+    RUN_TEST(test_q15_matrix);
+    RUN_TEST(test_fixed_point_ldl);
+    RUN_TEST(test_half_conversion);
+    RUN_TEST(test_half_storage);
+    RUN_TEST(test_fastMath);
+    RUN_TEST(test_dual_arithmetic);
+    RUN_TEST(test_jacobian);
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <linearAlgebra.hpp>
+#include <atomic>
+#ifdef NATIVE
+#include <thread>
+#endif
+using namespace operators;
+
+template <typename M>
+void fillMatrix(M &m, const size_t seed)
+{
+    for (size_t i = 0; i < m.rows(); i++)
+        for (size_t j = 0; j < m.cols(); j++)
+            m(i, j) = (float)((i * 31 + j * 17 + seed) % 23) / 23 - 0.5f;
+}
+
+template <typename T>
+void assertSame(const Vector<T> &expected, const Vector<T> &actual)
+{
+    TEST_ASSERT_EQUAL(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        TEST_ASSERT_EQUAL(expected[i], actual[i]);
+}
+
+void test_rowAlign(void) {
+    TEST_ASSERT_EQUAL(1, internal::threadPool::rowAlign(64));
+    TEST_ASSERT_EQUAL(1, internal::threadPool::rowAlign(128));
+    TEST_ASSERT_EQUAL(16, internal::threadPool::rowAlign(4));
+    TEST_ASSERT_EQUAL(2, internal::threadPool::rowAlign(5 * 8 * 4));
+    TEST_ASSERT_EQUAL(64, internal::threadPool::rowAlign(3));
+    TEST_ASSERT_EQUAL(0, internal::threadPool::triangularBound(10, 0, 4));
+    TEST_ASSERT_EQUAL(5, internal::threadPool::triangularBound(10, 1, 4));
+    TEST_ASSERT_EQUAL(10, internal::threadPool::triangularBound(10, 4, 4));
+}
+
+void test_parallel_products(void) {
+    // the blocks do the same operations in the same order : the results are identical
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    pool.threshold = 0;
+    const size_t sizes[][3] = {{37, 23, 29}, {3, 5, 2}, {64, 64, 64}, {1, 7, 100}};
+    for (size_t s = 0; s < 4; s++)
+    {
+        const size_t n = sizes[s][0], k = sizes[s][1], m = sizes[s][2];
+        rowMajorMatrix<float> ar(n, k), br(k, m);
+        colMajorMatrix<float> ac(n, k), bc(k, m);
+        fillMatrix(ar, 1);
+        fillMatrix(ac, 1);
+        fillMatrix(br, 2);
+        fillMatrix(bc, 2);
+        Vector<float> x(k);
+        for (size_t i = 0; i < k; i++)
+            x[i] = (float)i / k;
+
+        rowMajorMatrix<float> rr[2], rc[2], cr[2], cc[2];
+        Vector<float> y[2];
+        symMatrix<float> sym[2];
+        rowMajorMatrix<float> atr(m, k);
+        fillMatrix(atr, 3);
+        for (size_t threads = 1, t = 0; t < 2; threads = 4, t++)
+        {
+            pool.resize(threads);
+            TEST_ASSERT_EQUAL(threads, pool.size());
+            rr[t].holdMul(ar, br);
+            rc[t].holdMul(ar, bc);
+            cr[t].holdMul(ac, br);
+            cc[t].holdMul(ac, bc);
+            y[t].holdMul(ar, x);
+            sym[t].holdMul(atr, bc);
+        }
+        assertSame(rr[0], rr[1]);
+        assertSame(rc[0], rc[1]);
+        assertSame(cr[0], cr[1]);
+        assertSame(cc[0], cc[1]);
+        assertSame(y[0], y[1]);
+        assertSame(sym[0], sym[1]);
+        // every storage order gives the same product
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < m; j++)
+            {
+                TEST_ASSERT_FLOAT_WITHIN(1e-5, rr[0](i, j), rc[0](i, j));
+                TEST_ASSERT_FLOAT_WITHIN(1e-5, rr[0](i, j), cr[0](i, j));
+                TEST_ASSERT_FLOAT_WITHIN(1e-5, rr[0](i, j), cc[0](i, j));
+            }
+    }
+    pool.resize(1);
+    pool.threshold = threshold;
+}
+
+void test_parallel_threshold(void) {
+    internal::threadPool &pool = internal::threadPool::global();
+    pool.resize(4);
+    TEST_ASSERT_EQUAL(1, pool.partsFor(pool.threshold - 1));
+#ifdef NATIVE
+    TEST_ASSERT_EQUAL(4, pool.partsFor(pool.threshold));
+#endif
+    size_t calls = 0;
+    pool.forBlocks(100, 16, 0, [&](const size_t begin, const size_t end) {
+        TEST_ASSERT_EQUAL(0, begin);
+        TEST_ASSERT_EQUAL(100, end);
+        calls++;
+    });
+    TEST_ASSERT_EQUAL(1, calls);
+    pool.resize(1);
+}
+
+#ifdef NATIVE
+void test_parallel_concurrent_callers(void) {
+    // a kernel called while another one is split runs on its own thread
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    pool.threshold = 0;
+    pool.resize(3);
+    rowMajorMatrix<double> a(40, 40), b(40, 40), expected(40, 40);
+    fillMatrix(a, 4);
+    fillMatrix(b, 5);
+    expected.holdMul(a, b);
+    bool same[4] = {false, false, false, false};
+    rowMajorMatrix<double> c[4];
+    std::thread callers[4];
+    for (size_t t = 0; t < 4; t++)
+    {
+        c[t].resize(40, 40);
+        callers[t] = std::thread([&, t]() {
+            same[t] = true;
+            for (size_t r = 0; r < 20; r++)
+            {
+                c[t].holdMul(a, b);
+                for (size_t i = 0; i < c[t].size(); i++)
+                    same[t] = same[t] && c[t][i] == expected[i];
+            }
+        });
+    }
+    for (size_t t = 0; t < 4; t++)
+    {
+        callers[t].join();
+        TEST_ASSERT_TRUE(same[t]);
+    }
+    pool.resize(1);
+    pool.threshold = threshold;
+}
+#endif
+
+void test_parallel_for(void) {
+    const size_t threads[] = {1, 3, 4};
+    for (size_t t = 0; t < 3; t++)
+    {
+        setThreadCount(threads[t]);
+        TEST_ASSERT_EQUAL(threads[t], threadCount());
+        Vector<int> visits(1000);
+        visits.fill(0);
+        std::atomic<size_t> misaligned(0);
+        parallel_for(5, 1000, [&](const size_t begin, const size_t end) {
+            if ((begin - 5) % 16 != 0)
+                misaligned++;
+            for (size_t i = begin; i < end; i++)
+                visits[i]++;
+        }, 16);
+        TEST_ASSERT_EQUAL(0, misaligned.load());
+        for (size_t i = 0; i < 1000; i++)
+            TEST_ASSERT_EQUAL(i < 5 ? 0 : 1, visits[i]);
+        size_t calls = 0;
+        parallel_for(3, 3, [&](const size_t, const size_t) { calls++; });
+        TEST_ASSERT_EQUAL(0, calls);
+    }
+    setThreadCount(1);
+}
+
+void test_taskGroup(void) {
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    setThreadCount(3);
+    Vector<int> results(10);
+    results.fill(0);
+    taskGroup group;
+    for (size_t i = 0; i < 10; i++)
+        group.run([&results, i]() { results[i] = (int)(i * i); });
+    TEST_ASSERT_EQUAL(10, group.size());
+    TEST_ASSERT_EQUAL(0, results[3]);
+    group.wait();
+    TEST_ASSERT_EQUAL(0, group.size());
+    for (size_t i = 0; i < 10; i++)
+        TEST_ASSERT_EQUAL((int)(i * i), results[i]);
+
+    // kernels called from a task run on its thread
+    rowMajorMatrix<float> a(20, 20), b(20, 20), c[3];
+    fillMatrix(a, 6);
+    fillMatrix(b, 7);
+    pool.threshold = 0;
+    for (size_t i = 0; i < 3; i++)
+    {
+        c[i].resize(20, 20);
+        group.run([&, i]() { c[i].holdMul(a, b); });
+    }
+    group.wait();
+    rowMajorMatrix<float> expected(20, 20);
+    expected.holdMul(a, b);
+    for (size_t i = 0; i < 3; i++)
+        assertSame(expected, c[i]);
+    pool.threshold = threshold;
+    setThreadCount(1);
+}
+
+void test_parallel_ldl(void) {
+    const size_t n = 40;
+    ldl_matrix<double> ldl[2];
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    pool.threshold = 0;
+    for (size_t t = 0; t < 2; t++)
+    {
+        setThreadCount(t ? 4 : 1);
+        ldl[t].resize(n);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j <= i; j++)
+                ldl[t](i, j) = i == j ? n : 1.0 / (1 + i + j);
+        ldl[t].decompose();
+    }
+    assertSame(ldl[0].L, ldl[1].L);
+    assertSame(ldl[0].D, ldl[1].D);
+    pool.threshold = threshold;
+    setThreadCount(1);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    // Ajoute d'autres tests ici.
+    RUN_TEST(test_rowAlign);
+    RUN_TEST(test_parallel_products);
+    RUN_TEST(test_parallel_threshold);
+    RUN_TEST(test_parallel_for);
+    RUN_TEST(test_taskGroup);
+    RUN_TEST(test_parallel_ldl);
+#ifdef NATIVE
+    RUN_TEST(test_parallel_concurrent_callers);
+#endif
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
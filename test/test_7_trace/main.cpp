@@ -0,0 +1,385 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#define LINEAR_ALGEBRA_TRACE
+#define LINEAR_ALGEBRA_ACCOUNTING
+#define LINEAR_ALGEBRA_TRACE_SIZE 64
+#include <unity.h>
+#include <linearAlgebra.hpp>
+#ifdef NATIVE
+#include <sstream>
+#endif
+using namespace operators;
+
+// index of the last event of the snapshot matching on and what, -1 if none
+int find(const trace::event *events, const size_t count, const trace::object on, const trace::op what)
+{
+    for (int i = (int)count - 1; i >= 0; i--)
+        if (events[i].on == on && events[i].what == what)
+            return i;
+    return -1;
+}
+
+void test_kernel_events(void) {
+    rowMajorMatrix<float> a(3, 4), b(4, 2), c(3, 2);
+    a.fill(1);
+    b.fill(2);
+    trace::clear();
+    c.holdMul(a, b);
+    trace::event events[LINEAR_ALGEBRA_TRACE_SIZE];
+    const size_t count = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_TRUE(events[0].on == trace::object::rowMajorMatrix);
+    TEST_ASSERT_TRUE(events[0].what == trace::op::holdMul);
+    TEST_ASSERT_EQUAL(3, events[0].rows);
+    TEST_ASSERT_EQUAL(2, events[0].cols);
+    TEST_ASSERT_EQUAL(trace::thread(), events[0].thread);
+    TEST_ASSERT_EQUAL(8, c(0, 0));
+
+    // the accumulating kernels are told apart from the hold ones
+    symMatrix<float> s(3);
+    colMajorMatrix<float> at(4, 3);
+    rowMajorMatrix<float> bt(4, 3);
+    at.fill(1);
+    bt.fill(1);
+    s.fill(0);
+    trace::clear();
+    s.addMul(a, at);
+    s.subMul(a, bt);
+    TEST_ASSERT_EQUAL(2, trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE));
+    TEST_ASSERT_TRUE(events[0].what == trace::op::addMul && events[1].what == trace::op::subMul);
+    TEST_ASSERT_EQUAL_STRING("subMul", trace::name(events[1].what));
+}
+
+void test_nested_events(void) {
+    ldl_matrix<float> ldl(3);
+    ldl.fill(0);
+    for (size_t i = 0; i < 3; i++)
+        ldl(i, i) = 2;
+    symMatrix<float> inv(3);
+    trace::clear();
+    ldl.decompose();
+    inv.holdInv(ldl);
+    trace::event events[LINEAR_ALGEBRA_TRACE_SIZE];
+    const size_t count = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    const int decompose = find(events, count, trace::object::ldl_matrix, trace::op::decompose);
+    const int holdInv = find(events, count, trace::object::symMatrix, trace::op::holdInv);
+    TEST_ASSERT_TRUE(decompose >= 0);
+    TEST_ASSERT_TRUE(holdInv > decompose);
+    TEST_ASSERT_EQUAL(3, events[holdInv].rows);
+    // the events are recorded on return : the kernels called by holdInv come before it and lie within its duration
+    for (int i = decompose + 1; i < holdInv; i++)
+        TEST_ASSERT_TRUE((int32_t)(events[i].start - events[holdInv].start) >= 0);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, inv(1, 1));
+}
+
+void test_tmp_and_alloc_events(void) {
+    rowMajorMatrix<float> a(5, 5), b(5, 5), c;
+    a.fill(1);
+    b.fill(1);
+    internal::tmp<rowMajorMatrix<float>>::freeAll();
+    trace::clear();
+    c = a * b;
+    trace::event events[LINEAR_ALGEBRA_TRACE_SIZE];
+    size_t count = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    const int get = find(events, count, trace::object::tmp, trace::op::get);
+    TEST_ASSERT_TRUE(get >= 0);
+    TEST_ASSERT_EQUAL(25, events[get].rows);
+    // the pool was empty : get allocated its matrix
+    int alloc = -1;
+    for (int i = 0; i < get; i++)
+        if (events[i].what == trace::op::alloc && events[i].rows == 25 * sizeof(float))
+            alloc = i;
+    TEST_ASSERT_TRUE(alloc >= 0);
+    TEST_ASSERT_EQUAL(0, events[alloc].duration);
+
+    // c swapped its empty buffer with the temporary, which grows again the second time, but no more the third time
+    c = a * b;
+    trace::clear();
+    c = a * b;
+    count = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    TEST_ASSERT_TRUE(find(events, count, trace::object::tmp, trace::op::get) >= 0);
+    TEST_ASSERT_EQUAL(-1, find(events, count, trace::object::Vector, trace::op::alloc));
+}
+
+void test_ring_overwrite(void) {
+    Vector<float> x(4), y(4);
+    x.fill(1);
+    trace::clear();
+    for (size_t i = 0; i < 100; i++)
+        y.holdMul(x, (float)i);
+    TEST_ASSERT_EQUAL(100, trace::recorded());
+    trace::event events[LINEAR_ALGEBRA_TRACE_SIZE];
+    // only the last LINEAR_ALGEBRA_TRACE_SIZE are kept, the last max ones are returned
+    TEST_ASSERT_EQUAL(LINEAR_ALGEBRA_TRACE_SIZE, trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE));
+    TEST_ASSERT_EQUAL(10, trace::snapshot(events, 10));
+    for (size_t i = 0; i < 10; i++)
+        TEST_ASSERT_TRUE(events[i].what == trace::op::holdMul && events[i].rows == 4);
+    TEST_ASSERT_EQUAL_FLOAT(99, y[0]);
+}
+
+void test_dump(void) {
+    Vector<float> x(3), y(3);
+    x.fill(1);
+    trace::clear();
+    y.holdAdd(x, x);
+    y.holdSub(x, x);
+    // the writer must not call the library, its own events would overwrite the ones being sent
+    uint8_t bytes[256];
+    size_t written = 0;
+    const size_t size = trace::dump([&](const uint8_t *data, const size_t n) {
+        memcpy(bytes + written, data, n);
+        written += n;
+    });
+    TEST_ASSERT_EQUAL(16 + 2 * sizeof(trace::event), size);
+    TEST_ASSERT_EQUAL(size, written);
+    TEST_ASSERT_EQUAL('L', bytes[0]);
+    TEST_ASSERT_EQUAL('1', bytes[3]);
+#ifdef NATIVE
+    std::istringstream in(std::string((const char *)bytes, written));
+    std::vector<trace::event> events;
+    TEST_ASSERT_EQUAL(trace::ticksPerUs(), trace::readDump(in, events));
+    TEST_ASSERT_EQUAL(2, events.size());
+    TEST_ASSERT_TRUE(events[0].what == trace::op::holdAdd);
+    TEST_ASSERT_TRUE(events[1].what == trace::op::holdSub);
+    TEST_ASSERT_EQUAL(3, events[1].rows);
+#endif
+}
+
+#ifdef NATIVE
+void test_chrome_json(void) {
+    rowMajorMatrix<float> a(2, 2), b(2, 2), c;
+    a.fill(1);
+    b.fill(1);
+    internal::tmp<rowMajorMatrix<float>>::freeAll();
+    trace::clear();
+    c = a * b;
+    std::ostringstream out;
+    trace::writeChromeJson(out);
+    const std::string json = out.str();
+    TEST_ASSERT_EQUAL(0, json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    TEST_ASSERT_TRUE(json.find("\"name\":\"rowMajorMatrix::holdMul\",\"cat\":\"kernel\",\"ph\":\"X\"") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"name\":\"tmp::get\"") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"name\":\"alloc\",\"cat\":\"memory\",\"ph\":\"i\"") != std::string::npos);
+    TEST_ASSERT_TRUE(json.find("\"args\":{\"rows\":2,\"cols\":2}") != std::string::npos);
+    TEST_ASSERT_EQUAL(json.size() - 4, json.rfind("\n]}\n"));
+}
+#endif
+
+// counter of the kernel whose short name is given, nullptr if it was never called
+const accounting::counter *findCounter(const char *kernel)
+{
+    char name[192];
+    for (const accounting::counter *c = accounting::counter::first(); c; c = c->next)
+    {
+        accounting::internal::shortName(c->kernel, name, sizeof(name));
+        if (!strcmp(name, kernel))
+            return c;
+    }
+    return nullptr;
+}
+
+void test_accounting_dense(void) {
+    rowMajorMatrix<float> a(3, 4), b(4, 2), c(3, 2);
+    a.fill(1);
+    b.fill(2);
+    accounting::reset();
+    c.holdMul(a, b);
+    c.holdMul(a, b);
+    const accounting::counter *counter = findCounter("rowMajorMatrix<float>::holdMul(rowMajorMatrix<float>, rowMajorMatrix<float>)");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(2, counter->calls.load());
+    TEST_ASSERT_EQUAL(2 * 2 * 3 * 4 * 2, counter->flops.load());
+    TEST_ASSERT_EQUAL(2 * (12 + 8) * sizeof(float), counter->bytesRead.load());
+    TEST_ASSERT_EQUAL(2 * 6 * sizeof(float), counter->bytesWritten.load());
+    accounting::reset();
+    TEST_ASSERT_EQUAL(0, counter->calls.load());
+    TEST_ASSERT_EQUAL(0, counter->ticks.load());
+}
+
+void test_accounting_packed(void) {
+    // only the lower triangle of a symmetric result is computed and stored : 6 elements for an order 3
+    rowMajorMatrix<double> a(3, 2);
+    colMajorMatrix<double> b(2, 3);
+    a.fill(1);
+    b.fill(1);
+    symMatrix<double> s(3);
+    accounting::reset();
+    s.holdMul(a, b);
+    const accounting::counter *counter = findCounter("symMatrix<double>::holdMul(rowMajorMatrix<double>, colMajorMatrix<double>)");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(1, counter->calls.load());
+    TEST_ASSERT_EQUAL(2 * 6 * 2, counter->flops.load());
+    TEST_ASSERT_EQUAL((6 + 6) * sizeof(double), counter->bytesRead.load());
+    TEST_ASSERT_EQUAL(6 * sizeof(double), counter->bytesWritten.load());
+    TEST_ASSERT_EQUAL_FLOAT(2, s(2, 0));
+
+    // a packed operand is read once per stored element
+    colMajorMatrix<double> d(2, 3);
+    d.fill(1);
+    rowMajorMatrix<double> c(2, 3);
+    accounting::reset();
+    c.holdMul(d, s);
+    counter = findCounter("rowMajorMatrix<double>::holdMul(colMajorMatrix<double>, symMatrix<double>)");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL((6 + 6) * sizeof(double), counter->bytesRead.load());
+
+    // an accumulating kernel also reads the packed result and adds to it
+    rowMajorMatrix<double> e(2, 3);
+    e.fill(1);
+    accounting::reset();
+    s.subMul(a, e);
+    counter = findCounter("symMatrix<double>::subMul(rowMajorMatrix<double>, rowMajorMatrix<double>)");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(1, counter->calls.load());
+    TEST_ASSERT_EQUAL(2 * 6 * 2 + 6, counter->flops.load());
+    TEST_ASSERT_EQUAL((6 + 6 + 6) * sizeof(double), counter->bytesRead.load());
+    TEST_ASSERT_EQUAL(6 * sizeof(double), counter->bytesWritten.load());
+    TEST_ASSERT_EQUAL_FLOAT(0, s(2, 0));
+}
+
+// counter of the called kernel whose signature contains the given member, e.g. "symEigen<T>::decompose(", nullptr if none
+const accounting::counter *findCalled(const char *member)
+{
+    for (const accounting::counter *c = accounting::counter::first(); c; c = c->next)
+        if (c->calls && strstr(c->kernel, member))
+            return c;
+    return nullptr;
+}
+
+void test_accounting_solvers(void) {
+    // the hand written O(n^3) kernels are accounted with the costs stated in their headers
+    symMatrix<double> a(3);
+    a.fill(0);
+    for (size_t i = 0; i < 3; i++)
+        a(i, i) = i + 1;
+    symEigen<double> eigen(3, 0);
+    Vector<double> values;
+    accounting::reset();
+    trace::clear();
+    eigen.eigenvalues(values, a);
+    const accounting::counter *counter = findCalled("symEigen<T>::decompose(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(1, counter->calls.load());
+    TEST_ASSERT_EQUAL(4 * 27 / 3 + 30 * 9, counter->flops.load());
+    TEST_ASSERT_EQUAL(6 * sizeof(double), counter->bytesRead.load());
+    trace::event events[LINEAR_ALGEBRA_TRACE_SIZE];
+    const size_t count = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    TEST_ASSERT_TRUE(find(events, count, trace::object::symEigen, trace::op::decompose) >= 0);
+
+    rowMajorMatrix<double> b(4, 2), pinv;
+    b.fill(0);
+    b(0, 0) = b(1, 1) = 1;
+    svd<double> decomposition(4, 2);
+    accounting::reset();
+    decomposition.pinv(pinv, b);
+    counter = findCalled("svd<T>::orthogonalize(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(8 * 6 * (4 * 2 * 2 + 2 * 2 * 2), counter->flops.load());
+    counter = findCalled("svd<T>::pinv(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(8 * 6 * (4 * 2 * 2 + 2 * 2 * 2) + 2 * 4 * 2 * 2, counter->flops.load());
+    TEST_ASSERT_EQUAL(8 * sizeof(double), counter->bytesWritten.load());
+
+    ud_filter<double, 3> filter;
+    filter.setCovariance(a);
+    Vector<double> h(3);
+    h.fill(1);
+    accounting::reset();
+    trace::clear();
+    filter.predict(filter.x);
+    filter.update(1.0, h, 1.0);
+    filter.getCovariance(a);
+    counter = findCalled("ud_filter<T, N, K>::predict(const");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(3 * 3 * 2 + 3 * 3 * 6 + 3 * (4 * 6 + 1), counter->flops.load());
+    counter = findCalled("ud_filter<T, N, K>::updateScalar(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(3 * 3 * 2 + 9 * 3, counter->flops.load());
+    counter = findCalled("ud_filter<T, N, K>::getCovariance(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(12 + 6, counter->flops.load());
+    const size_t traced = trace::snapshot(events, LINEAR_ALGEBRA_TRACE_SIZE);
+    TEST_ASSERT_TRUE(find(events, traced, trace::object::ud_filter, trace::op::predict) >= 0);
+    TEST_ASSERT_TRUE(find(events, traced, trace::object::ud_filter, trace::op::update) >= 0);
+
+    innovationGate<double> gate(3, 4);
+    gate.setCovariance(a);
+    colMajorMatrix<double> innovations(3, 4);
+    innovations.fill(1);
+    Vector<double> d2(4);
+    accounting::reset();
+    gate.mahalanobis(d2, innovations);
+    counter = findCalled("innovationGate<T>::solve(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(3 * 2 * 4 + 3 * 3 * 4 + 3, counter->flops.load());
+    TEST_ASSERT_EQUAL((12 + 3 + 3) * sizeof(double), counter->bytesRead.load());
+
+    rowMajorMatrix<double> generator(3, 3), exponential;
+    generator.fill(0);
+    generator(0, 1) = 1;
+    expm<double> exponentiation(3);
+    accounting::reset();
+    exponentiation.compute(exponential, generator);
+    counter = findCalled("expm<T>::solve(");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(1, counter->calls.load());
+    TEST_ASSERT_EQUAL(2 * 3 * 5 / 3 + 7 * 2 * 3 / 2 + 9 * 2 + 9 + 3, counter->flops.load());
+}
+
+void test_accounting_report(void) {
+    Vector<float> x(100), y(100);
+    x.fill(1);
+    accounting::reset();
+    for (size_t i = 0; i < 10; i++)
+        y.holdAdd(x, x);
+    const String report = accounting::report(1, 1);
+    const char *text = report.c_str();
+    TEST_ASSERT_TRUE(strstr(text, "roofline : peak 1.000 GFLOP/s, bandwidth 1.000 GB/s, ridge 1.000 FLOP/byte") == text);
+    TEST_ASSERT_NOT_NULL(strstr(text, "Vector<float>::holdAdd(Vector<float>, Vector<float>)"));
+    // 100 FLOP for 1200 bytes : memory bound
+    TEST_ASSERT_NOT_NULL(strstr(text, "0.083"));
+    TEST_ASSERT_NOT_NULL(strstr(text, "memory"));
+    // the kernels not called since the reset are not reported
+    TEST_ASSERT_NULL(strstr(text, "rowMajorMatrix<float>::holdMul"));
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    // Ajoute d'autres tests ici.
+    RUN_TEST(test_kernel_events);
+    RUN_TEST(test_nested_events);
+    RUN_TEST(test_tmp_and_alloc_events);
+    RUN_TEST(test_ring_overwrite);
+    RUN_TEST(test_dump);
+    RUN_TEST(test_accounting_dense);
+    RUN_TEST(test_accounting_packed);
+    RUN_TEST(test_accounting_solvers);
+    RUN_TEST(test_accounting_report);
+#ifdef NATIVE
+    RUN_TEST(test_chrome_json);
+#endif
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
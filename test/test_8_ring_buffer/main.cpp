@@ -0,0 +1,141 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <linearAlgebra.hpp>
+#ifdef NATIVE
+#include <thread>
+#endif
+using namespace operators;
+
+void test_push_pop(void) {
+    ringBuffer<float> r(4);
+    TEST_ASSERT_EQUAL(4, r.capacity());
+    TEST_ASSERT_TRUE(r.empty());
+    float v = 0;
+    TEST_ASSERT_FALSE(r.pop(v));
+    for (int i = 0; i < 4; i++)
+        TEST_ASSERT_TRUE(r.push(i));
+    TEST_ASSERT_TRUE(r.full());
+    TEST_ASSERT_FALSE(r.push(4));
+    TEST_ASSERT_EQUAL(0, r[0]);
+    TEST_ASSERT_EQUAL(3, r.back());
+    // goes around the storage several times
+    for (int i = 4; i < 20; i++) {
+        TEST_ASSERT_TRUE(r.pop(v));
+        TEST_ASSERT_EQUAL(i - 4, v);
+        TEST_ASSERT_TRUE(r.push(i));
+        TEST_ASSERT_EQUAL(4, r.size());
+    }
+    r.discard(3);
+    TEST_ASSERT_EQUAL(1, r.size());
+    TEST_ASSERT_EQUAL(19, r[0]);
+    r.discard(10);
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+void test_views(void) {
+    ringBuffer<double> r(5);
+    Vector<double> first, second;
+    r.views(first, second);
+    TEST_ASSERT_EQUAL(0, first.size());
+    TEST_ASSERT_EQUAL(0, second.size());
+    for (int i = 0; i < 8; i++)
+        r.slide(i);
+    // storage : 5 6 7 3 4
+    r.views(first, second);
+    TEST_ASSERT_EQUAL(2, first.size());
+    TEST_ASSERT_EQUAL(3, second.size());
+    TEST_ASSERT_EQUAL(3, first[0]);
+    TEST_ASSERT_EQUAL(7, second[2]);
+    TEST_ASSERT_TRUE(first.shared());
+    Vector<double> ones(5);
+    ones.fill(1);
+    Vector<double> window;
+    r.copyTo(window);
+    TEST_ASSERT_EQUAL(25, window.dot(ones));
+
+    // the views do not allocate, even when they owned memory before
+    Vector<double> owned(10);
+    const size_t allocated = internal::alloc_count;
+    r.views(owned, second);
+    TEST_ASSERT_EQUAL(allocated - 10 * sizeof(double), internal::alloc_count);
+    TEST_ASSERT_EQUAL(3, owned[0]);
+}
+
+void test_linearize(void) {
+    ringBuffer<float> r(5);
+    for (int i = 0; i < 8; i++)
+        r.slide(i);
+    Vector<float> view;
+    r.linearize(view);
+    TEST_ASSERT_EQUAL(5, view.size());
+    for (size_t i = 0; i < 5; i++)
+        TEST_ASSERT_EQUAL(3 + i, view[i]);
+    // still a ring buffer afterwards
+    r.slide(8);
+    TEST_ASSERT_EQUAL(4, r[0]);
+    TEST_ASSERT_EQUAL(8, r.back());
+    r.linearize(view);
+    TEST_ASSERT_EQUAL(4, view[0]);
+    Vector<float> w(5);
+    w.fill(1);
+    TEST_ASSERT_EQUAL(30, view.dot(w));
+}
+
+#ifdef NATIVE
+void test_spsc(void) {
+    const uint32_t n = 200000;
+    ringBuffer<uint32_t> r(64);
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < n;)
+            if (r.push(i))
+                i++;
+    });
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < n) {
+        uint32_t v;
+        if (r.pop(v)) {
+            ordered = ordered && v == expected;
+            expected++;
+        }
+    }
+    producer.join();
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(r.empty());
+}
+#endif
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(test_push_pop);
+    RUN_TEST(test_views);
+    RUN_TEST(test_linearize);
+#ifdef NATIVE
+    RUN_TEST(test_spsc);
+#endif
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file
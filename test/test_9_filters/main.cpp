@@ -0,0 +1,666 @@
+/*
+to run all the test use the following command
+pio test -e native
+*/
+
+#include <unity.h>
+#include <linearAlgebra.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+using namespace operators;
+
+// counts the heap allocations made while counting is set, the worker threads of the pool allocate too
+static std::atomic<bool> counting(false);
+static std::atomic<size_t> allocations(0);
+void *operator new(size_t size) {
+    if (counting)
+        allocations++;
+    void *p = malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+// the replaced operator new allocates with malloc, gcc does not see it when it pairs free with operator new
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t) noexcept { operator delete(p); }
+
+// pseudo random in [-0.5, 0.5)
+double noise(uint32_t &seed) {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) / 16777216.0 - 0.5;
+}
+
+// position, velocity, acceleration with a position and a squared speed measurement
+const double dt = 0.01;
+void f(Vector<double> &fx, const Vector<double> &x, const Vector<double> &) {
+    fx[0] = x[0] + dt * x[1];
+    fx[1] = x[1] + dt * x[2];
+    fx[2] = x[2];
+}
+void df(rowMajorMatrix<double> &F, const Vector<double> &, const Vector<double> &) {
+    F.fill(0);
+    F(0, 0) = F(1, 1) = F(2, 2) = 1;
+    F(0, 1) = F(1, 2) = dt;
+}
+void h(Vector<double> &hx, const Vector<double> &x) {
+    hx[0] = x[0];
+    hx[1] = x[1] * x[1];
+}
+void dh(rowMajorMatrix<double> &H, const Vector<double> &x) {
+    H.fill(0);
+    H(0, 0) = 1;
+    H(1, 1) = 2 * x[1];
+}
+
+void initialize(ekf<double, 3, 2> &filter) {
+    filter.x[1] = 1;
+    for (size_t i = 0; i < 3; i++) {
+        filter.P(i, i) = 1;
+        filter.Q(i, i) = 1e-6;
+    }
+    filter.R(0, 0) = 1e-2;
+    filter.R(1, 1) = 1e-2;
+    filter.R(1, 0) = 1e-3;
+}
+
+void test_ekf_reference(void) {
+    // the same steps written with the operators and the closed form inverse of S
+    ekf<double, 3, 2> filter(f, df, h, dh);
+    initialize(filter);
+    Vector<double> x(filter.x), z(2), hx(2), y(2), u;
+    rowMajorMatrix<double> F(3, 3), H(2, 3), P(3, 3), Q(3, 3), R(2, 2), S(2, 2), K(3, 2);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+            P(i, j) = filter.P(i, j), Q(i, j) = filter.Q(i, j);
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 2; j++)
+            R(i, j) = filter.R(i, j);
+    rowMajorMatrix<double> Sinv(2, 2);
+    uint32_t seed = 1;
+    for (size_t k = 0; k < 50; k++) {
+        const double t = k * dt;
+        z[0] = 0.5 * t * t + 0.1 * noise(seed);
+        z[1] = (1 + t) * (1 + t) + 0.1 * noise(seed);
+        filter.predict()->update(z);
+
+        df(F, x, u);
+        Vector<double> fx(3);
+        f(fx, x, u);
+        x = fx;
+        P = F * P * rowMajorMatrix<double>(colMajorMatrix<double>(F.begin(), 3, 3)) + Q;
+        dh(H, x);
+        h(hx, x);
+        y = z - hx;
+        rowMajorMatrix<double> Ht(colMajorMatrix<double>(H.begin(), 3, 2));
+        S = H * P * Ht + R;
+        const double det = S(0, 0) * S(1, 1) - S(0, 1) * S(1, 0);
+        Sinv(0, 0) = S(1, 1) / det;
+        Sinv(1, 1) = S(0, 0) / det;
+        Sinv(1, 0) = Sinv(0, 1) = -S(1, 0) / det;
+        K = P * Ht * Sinv;
+        x += K * y;
+        P -= K * H * P;
+    }
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, x[i], filter.x[i]);
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, P(i, j), filter.P(i, j));
+        for (size_t j = 0; j < 2; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, K(i, j), filter.gain()(i, j));
+    }
+    // the true state is (0.5 t^2, 1 + t, 1)
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 1.5, filter.x[1]);
+}
+
+void test_ekf_no_allocation(void) {
+    ekf<double, 3, 2> filter(f, df, h, dh);
+    initialize(filter);
+    Vector<double> z(2);
+    uint32_t seed = 2;
+    const size_t allocated = internal::alloc_count;
+    const size_t tmpVectors = internal::tmp_count;
+    // on one thread, then with every kernel split over the threads
+    internal::threadPool &pool = internal::threadPool::global();
+    const size_t threshold = pool.threshold;
+    for (size_t threads = 1; threads <= 3; threads += 2) {
+        setThreadCount(threads);
+        pool.threshold = threads > 1 ? 0 : threshold;
+        allocations = 0;
+        counting = true;
+        for (size_t k = 0; k < 100; k++) {
+            z[0] = 0.1 * noise(seed);
+            z[1] = 1 + 0.1 * noise(seed);
+            filter.predict();
+            filter.update(z);
+        }
+        counting = false;
+        TEST_ASSERT_EQUAL(0, allocations);
+    }
+    setThreadCount(1);
+    pool.threshold = threshold;
+    TEST_ASSERT_EQUAL(allocated, internal::alloc_count);
+    TEST_ASSERT_EQUAL(tmpVectors, internal::tmp_count);
+    TEST_ASSERT_EQUAL(0, internal::tmp<rowMajorMatrix<double>>::currentlyUsedCount());
+}
+
+void test_solveLDL(void) {
+    symMatrix<double> s(3);
+    s(0, 0) = 4; s(1, 0) = 1; s(1, 1) = 3; s(2, 0) = -1; s(2, 1) = 0.5; s(2, 2) = 2;
+    ldl_matrix<double> ldl(3);
+    ldl.hold(s);
+    ldl.decompose();
+    rowMajorMatrix<double> b(3, 2), x;
+    for (size_t i = 0; i < 3; i++) {
+        b(i, 0) = i + 1;
+        b(i, 1) = 1.0 - i;
+    }
+    x.holdSolveLDL(ldl, b);
+    Vector<double> v(3), column(3);
+    for (size_t j = 0; j < 2; j++) {
+        for (size_t i = 0; i < 3; i++)
+            column[i] = b(i, j);
+        v.holdSolveLDL(ldl, column);
+        for (size_t i = 0; i < 3; i++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, v[i], x(i, j));
+            double r = 0;
+            for (size_t k = 0; k < 3; k++)
+                r += s(i, k) * x(k, j);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, b(i, j), r);
+        }
+    }
+    // in place
+    b.holdSolveLDL(ldl, b);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, x(2, 1), b(2, 1));
+    // inverse (overwrites the factor)
+    symMatrix<double> inv(3);
+    inv.holdInv(ldl);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++) {
+            double r = 0;
+            for (size_t k = 0; k < 3; k++)
+                r += s(i, k) * inv(k, j);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-12, i == j, r);
+        }
+}
+
+// same model with a linear measurement of the position and the velocity, for the UD filter
+void hLinear(Vector<double> &hx, const Vector<double> &x) {
+    hx[0] = x[0];
+    hx[1] = x[1];
+}
+void dhLinear(rowMajorMatrix<double> &H, const Vector<double> &) {
+    H.fill(0);
+    H(0, 0) = H(1, 1) = 1;
+}
+
+void test_ud_filter_reference(void) {
+    ekf<double, 3, 2> reference(f, df, hLinear, dhLinear);
+    initialize(reference);
+    reference.P(1, 0) = 0.5;
+    reference.R(1, 0) = 0;
+    ud_filter<double, 3> filter;
+    filter.x.hold(reference.x);
+    filter.setCovariance(reference.P);
+    df(filter.F, filter.x, filter.x);
+    for (size_t i = 0; i < 3; i++)
+        filter.Q(i, i) = reference.Q(i, i);
+    rowMajorMatrix<double> H(2, 3);
+    dhLinear(H, filter.x);
+    diagMatrix<double> R(2);
+    R(0, 0) = reference.R(0, 0);
+    R(1, 1) = reference.R(1, 1);
+    Vector<double> z(2);
+    uint32_t seed = 3;
+    allocations = 0;
+    counting = true;
+    for (size_t k = 0; k < 50; k++) {
+        const double t = k * dt;
+        z[0] = 0.5 * t * t + 0.1 * noise(seed);
+        z[1] = t + 0.1 * noise(seed);
+        reference.predict()->update(z);
+        filter.predict()->update(z, H, R);
+    }
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    symMatrix<double> P;
+    filter.getCovariance(P);
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, reference.x[i], filter.x[i]);
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, reference.P(i, j), P(i, j));
+    }
+    // a scalar update with a prediction of the measurement gives the same result
+    ud_filter<double, 3> scalar;
+    scalar.setCovariance(P);
+    scalar.x.hold(filter.x);
+    Vector<double> h(3);
+    h.fill(0);
+    h[0] = 1;
+    filter.update(0.2, h, 0.01);
+    scalar.update(0.2, scalar.x[0], h, 0.01);
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, filter.x[i], scalar.x[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, filter.gain()[i], scalar.gain()[i]);
+    }
+}
+
+void test_ud_filter_float(void) {
+    // nearly perfect measurements of a state known to 1e3 : P -= K*H*P computed in float collapses to 0 while the UD factors keep every digit
+    ud_filter<float, 2> single;
+    ud_filter<double, 2> reference;
+    symMatrix<double> P0(2);
+    P0(0, 0) = P0(1, 1) = 1e6;
+    P0(1, 0) = 0;
+    symMatrix<float> P0f(2);
+    P0f.hold(P0);
+    reference.setCovariance(P0);
+    single.setCovariance(P0f);
+    Vector<double> h(2);
+    Vector<float> hf(2);
+    for (size_t k = 0; k < 4; k++) {
+        h[0] = hf[0] = 1;
+        h[1] = hf[1] = k % 2 ? 1 : 0;
+        reference.predict()->update(0.0, h, 1e-6);
+        single.predict()->update(0.0f, hf, 1e-6f);
+    }
+    symMatrix<double> P;
+    symMatrix<float> Pf;
+    reference.getCovariance(P);
+    single.getCovariance(Pf);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1e-6, P(1, 1));
+    for (size_t i = 0; i < 2; i++) {
+        TEST_ASSERT_TRUE(single.P.D[i] > 0);
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-4 * fabs(P(i, j)), P(i, j), Pf(i, j));
+    }
+}
+
+// the same models evaluated on all the sigma points at once
+void fBatch(colMajorMatrix<double> &out, const colMajorMatrix<double> &points, const Vector<double> &u) {
+    for (size_t k = 0; k < points.cols(); k++) {
+        const Vector<double> point(points.begin() + k * 3, 3, true);
+        Vector<double> fx(out.begin() + k * 3, 3, true);
+        f(fx, point, u);
+    }
+}
+void hBatch(colMajorMatrix<double> &out, const colMajorMatrix<double> &points) {
+    for (size_t k = 0; k < points.cols(); k++) {
+        const Vector<double> point(points.begin() + k * 3, 3, true);
+        Vector<double> hx(out.begin() + k * 2, 2, true);
+        hLinear(hx, point);
+    }
+}
+void hSquare(colMajorMatrix<double> &out, const colMajorMatrix<double> &points) {
+    for (size_t k = 0; k < points.cols(); k++) {
+        const double *point = points.begin() + k * 3;
+        out.begin()[k * 2] = point[0] * point[0];
+        out.begin()[k * 2 + 1] = point[1];
+    }
+}
+
+void test_ukf_linear(void) {
+    // with linear models the unscented transform is exact, whatever the spread of the sigma points
+    const double alphas[] = {1, 0.5};
+    for (size_t a = 0; a < 2; a++) {
+        ekf<double, 3, 2> reference(f, df, hLinear, dhLinear);
+        initialize(reference);
+        reference.P(1, 0) = 0.5;
+        ukf<double, 3, 2> filter(fBatch, hBatch, alphas[a]);
+        filter.x.hold(reference.x);
+        filter.P.hold(reference.P);
+        filter.Q.hold(reference.Q);
+        filter.R.hold(reference.R);
+        Vector<double> z(2);
+        uint32_t seed = 4;
+        allocations = 0;
+        counting = true;
+        for (size_t k = 0; k < 50; k++) {
+            const double t = k * dt;
+            z[0] = 0.5 * t * t + 0.1 * noise(seed);
+            z[1] = t + 0.1 * noise(seed);
+            reference.predict()->update(z);
+            filter.predict()->update(z);
+        }
+        counting = false;
+        TEST_ASSERT_EQUAL(0, allocations);
+        for (size_t i = 0; i < 3; i++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, reference.x[i], filter.x[i]);
+            for (size_t j = 0; j <= i; j++)
+                TEST_ASSERT_DOUBLE_WITHIN(1e-9, reference.P(i, j), filter.P(i, j));
+            for (size_t j = 0; j < 2; j++)
+                TEST_ASSERT_DOUBLE_WITHIN(1e-9, reference.gain()(i, j), filter.gain()(i, j));
+        }
+    }
+}
+
+void test_ukf_square(void) {
+    // E[x0^2] = mean^2 + variance for a gaussian x0 : the sigma points capture it exactly
+    ukf<double, 3, 2> filter(fBatch, hSquare);
+    filter.x[0] = 2;
+    filter.x[1] = 1;
+    filter.P(0, 0) = 0.5;
+    filter.P(1, 0) = 0.1;
+    filter.P(1, 1) = 0.2;
+    filter.P(2, 2) = 1;
+    filter.R(0, 0) = filter.R(1, 1) = 0.01;
+    Vector<double> z(2);
+    z[0] = 4;
+    z[1] = 1;
+    filter.update(z);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 4.5, filter.predictedMeasurement()[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1, filter.predictedMeasurement()[1]);
+    // cov(x0^2, x1) = 2*mean0*cov(x0, x1)
+    const MatrixBase<double> &S = filter.innovationCovariance();
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 2 * 2 * 0.1, S(1, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -0.5, filter.innovation()[0]);
+}
+
+// random walk of a 1D position observed with a gaussian noise of standard deviation 0.5, for the particle filter
+static size_t step = 0;
+double hashNoise(size_t i) {
+    uint32_t seed = (uint32_t)(i * 2654435761u + step * 40503u);
+    return noise(seed) + noise(seed);
+}
+void walk(colMajorMatrix<double> &states, const size_t begin, const size_t end, const Vector<double> &) {
+    double *position = states.begin();
+    for (size_t i = begin; i < end; i++)
+        position[i] += 0.1 * hashNoise(i);
+}
+void gaussian(Vector<double> &logLikelihood, const colMajorMatrix<double> &states, const size_t begin, const size_t end, const Vector<double> &z) {
+    const double *position = states.begin();
+    for (size_t i = begin; i < end; i++) {
+        const double d = (position[i] - z[0]) / 0.5;
+        logLikelihood[i] = -0.5 * d * d;
+    }
+}
+
+void test_particle_resampling(void) {
+    const size_t n = 1000;
+    particleFilter<double> filter(n, 2, walk, gaussian);
+    // uniform and normalized from the start : exp(-log(n)) summed n times is 1
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -log((double)n), filter.logWeights()[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, -log((double)n), filter.logWeights()[n - 1]);
+    for (size_t i = 0; i < n; i++) {
+        filter.states()(i, 0) = i;
+        filter.states()(i, 1) = -(double)i;
+    }
+    // log weights far below the range of exp : only their differences matter
+    Vector<double> z(1);
+    z[0] = 500;
+    filter.update(z);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1, filter.weights().sum());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, exp(-2.0), filter.weights()[501] / filter.weights()[500]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, -2, filter.logWeights()[501] - filter.logWeights()[500]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, -0.5 * 1000 * 1000, filter.logWeights()[0] - filter.logWeights()[500]);
+    Vector<double> weights(filter.weights());
+    Vector<double> m;
+    filter.mean(m);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 500, m[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, -500, m[1]);
+
+    // every particle is drawn floor or ceil of n * its weight times
+    Vector<size_t> counts(n);
+    for (size_t scheme = 0; scheme < 2; scheme++) {
+        particleFilter<double> copy(n, 2, walk, gaussian);
+        for (size_t i = 0; i < n; i++) {
+            copy.states()(i, 0) = i;
+            copy.states()(i, 1) = -(double)i;
+        }
+        copy.update(z);
+        uint32_t seed = 5;
+        auto uniform = [&]() { return noise(seed) + 0.5; };
+        allocations = 0;
+        counting = true;
+        if (scheme == 0)
+            copy.resampleSystematic(0.5);
+        else
+            copy.resampleStratified(uniform);
+        counting = false;
+        TEST_ASSERT_EQUAL(0, allocations);
+        counts.fill(0);
+        for (size_t i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL(-copy.states()(i, 0), copy.states()(i, 1));
+            counts[(size_t)copy.states()(i, 0)]++;
+        }
+        for (size_t i = 0; i < n; i++)
+            TEST_ASSERT_TRUE(fabs(counts[i] - n * weights[i]) < (scheme == 0 ? 1 : 2));
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, n, copy.effectiveSampleSize());
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, -log((double)n), copy.logWeights()[n / 2]);
+    }
+
+    // a measurement no particle explains
+    particleFilter<double> lost(n, 2, walk, [](Vector<double> &logLikelihood, const colMajorMatrix<double> &, const size_t begin, const size_t end, const Vector<double> &) {
+        for (size_t i = begin; i < end; i++)
+            logLikelihood[i] = -INFINITY;
+    });
+    bool thrown = false;
+    try {
+        lost.update(z);
+    } catch (const char *) {
+        thrown = true;
+    }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void test_particle_filter(void) {
+    // tracks a walking position from measurements, with the propagation and the weighting split over 3 threads
+    const size_t n = 4096;
+    particleFilter<double> filter(n, 1, walk, gaussian);
+    for (size_t i = 0; i < n; i++)
+        filter.states()(i, 0) = 4 * hashNoise(n + i);
+    setThreadCount(3);
+    Vector<double> z(1), m(1);
+    uint32_t seed = 6;
+    double truth = 1;
+    allocations = 0;
+    counting = true;
+    for (step = 1; step <= 100; step++) {
+        truth += 0.1 * (noise(seed) + noise(seed));
+        z[0] = truth + 0.5 * (noise(seed) + noise(seed));
+        filter.predict(true)->update(z, true);
+        if (filter.effectiveSampleSize() < n / 2)
+            filter.resampleSystematic(noise(seed) + 0.5);
+    }
+    counting = false;
+    setThreadCount(1);
+    TEST_ASSERT_EQUAL(0, allocations);
+    filter.mean(m);
+    TEST_ASSERT_DOUBLE_WITHIN(0.5, truth, m[0]);
+}
+
+void regressor(Vector<double> &phi, uint32_t &seed) {
+    phi[0] = 1;
+    phi[1] = 2 * noise(seed);
+    phi[2] = phi[1] * phi[1] + noise(seed);
+}
+
+void test_rls(void) {
+    // y = 0.5 - 2 x + 3 x^2
+    rls<double, 3> estimator;
+    Vector<double> phi(3), theta(3);
+    theta[0] = 0.5;
+    theta[1] = -2;
+    theta[2] = 3;
+    uint32_t seed = 7;
+    allocations = 0;
+    counting = true;
+    for (size_t k = 0; k < 200; k++) {
+        regressor(phi, seed);
+        estimator.update(phi, phi.dot(theta) + 0.01 * noise(seed));
+    }
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    for (size_t i = 0; i < 3; i++)
+        TEST_ASSERT_DOUBLE_WITHIN(1e-2, theta[i], estimator.theta[i]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 0, estimator.error());
+
+    // the forgetting factor follows a change of the parameters
+    rls<double, 3> forgetting(0.9);
+    theta[1] = 1;
+    for (size_t k = 0; k < 400; k++) {
+        if (k == 200)
+            theta[1] = -1;
+        regressor(phi, seed);
+        forgetting.update(phi, phi.dot(theta));
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, -1, forgetting.theta[1]);
+
+    // without excitation P grows by 1/lambda at each sample until it is reset
+    forgetting.maxTrace = 1e4;
+    phi.fill(0);
+    double largest = 0;
+    for (size_t k = 0; k < 200; k++) {
+        forgetting.update(phi, 0);
+        largest = forgetting.P.trace() > largest ? forgetting.P.trace() : largest;
+    }
+    TEST_ASSERT_TRUE(largest <= 1e4);
+    TEST_ASSERT_TRUE(largest > 1e4 * 0.9 - 1);
+}
+
+void test_rls_block(void) {
+    // blocks of 4 samples give the same estimate as the samples one by one
+    rls<double, 3> single(0.95, 10);
+    rls<double, 3, 4> block(0.95, 10);
+    Vector<double> phi(3), y(4), theta(3);
+    theta[0] = 1;
+    theta[1] = 2;
+    theta[2] = -1;
+    rowMajorMatrix<double> Phi(4, 3);
+    uint32_t seed = 8;
+    allocations = 0;
+    counting = true;
+    for (size_t b = 0; b < 25; b++) {
+        for (size_t i = 0; i < 4; i++) {
+            regressor(phi, seed);
+            y[i] = phi.dot(theta) + 0.1 * noise(seed);
+            for (size_t j = 0; j < 3; j++)
+                Phi(i, j) = phi[j];
+            single.update(phi, y[i]);
+        }
+        block.update(Phi, y);
+    }
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, single.theta[i], block.theta[i]);
+        for (size_t j = 0; j <= i; j++)
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, single.P(i, j), block.P(i, j));
+    }
+}
+
+void test_innovation_gate(void) {
+    // the quantiles against tabulated values
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 3.841458820694124, innovationGate<double>::chiSquareQuantile(1, 0.95));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, -2 * log(0.01), innovationGate<double>::chiSquareQuantile(2, 0.99));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 7.814727903251178, innovationGate<double>::chiSquareQuantile(3, 0.95));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 18.46682695290317, innovationGate<double>::chiSquareQuantile(4, 0.999));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 124.3421134, innovationGate<double>::chiSquareQuantile(100, 0.95));
+
+    // the squared distances and the log-likelihoods against one ldl solve per candidate
+    const size_t m = 3, K = 6;
+    symMatrix<double> S(m);
+    S(0, 0) = 2;
+    S(1, 0) = 0.3;
+    S(1, 1) = 1;
+    S(2, 0) = -0.2;
+    S(2, 1) = 0.1;
+    S(2, 2) = 0.5;
+    const double det = 2 * (1 * 0.5 - 0.1 * 0.1) - 0.3 * (0.3 * 0.5 - 0.1 * -0.2) + -0.2 * (0.3 * 0.1 - 1 * -0.2);
+    innovationGate<double> gate(m, 2, 0.95);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 7.814727903251178, gate.threshold());
+    gate.setCovariance(S);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, log(det), gate.logDeterminant());
+    colMajorMatrix<double> innovations(m, K);
+    uint32_t seed = 21;
+    for (size_t i = 0; i < m * K; i++)
+        innovations.begin()[i] = 6 * noise(seed);
+    // the capacity of 2 candidates grows to 6 at the first batch
+    Vector<double> d2, likelihood(K);
+    Vector<size_t> accepted(K);
+    gate.mahalanobis(d2, innovations);
+    TEST_ASSERT_EQUAL(K, d2.size());
+    ldl_matrix<double> factor(m);
+    factor.hold(S, false);
+    factor.decompose();
+    Vector<double> nu(m), x(m);
+    for (size_t k = 0; k < K; k++) {
+        for (size_t i = 0; i < m; i++)
+            nu[i] = innovations(i, k);
+        x.holdSolveLDL(factor, nu);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, nu.dot(x), d2[k]);
+    }
+    allocations = 0;
+    counting = true;
+    gate.logLikelihood(likelihood, innovations);
+    const size_t count = gate.gate(accepted, d2, innovations);
+    counting = false;
+    TEST_ASSERT_EQUAL(0, allocations);
+    size_t expected = 0;
+    for (size_t k = 0; k < K; k++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, -0.5 * (d2[k] + log(det) + m * log(2 * M_PI)), likelihood[k]);
+        if (d2[k] <= gate.threshold()) {
+            TEST_ASSERT_TRUE(expected < count);
+            TEST_ASSERT_EQUAL(k, accepted[expected++]);
+        }
+    }
+    TEST_ASSERT_EQUAL(expected, count);
+    TEST_ASSERT_TRUE(count > 0 && count < K);
+
+    // the factor of a filter update taken as it is
+    gate.setFactor(factor);
+    Vector<double> again;
+    gate.mahalanobis(again, innovations);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY(d2.begin(), again.begin(), K);
+    S(2, 2) = -1;
+    bool thrown = false;
+    try { gate.setCovariance(S); } catch (const char *) { thrown = true; }
+    TEST_ASSERT_TRUE(thrown);
+}
+
+void setUp() {
+    // Initialisation avant chaque test (laisser vide si inutile)
+}
+
+void tearDown() {
+    // Nettoyage après chaque test (laisser vide si inutile)
+}
+
+
+void setup() {
+    UNITY_BEGIN();
+    RUN_TEST(test_solveLDL);
+    RUN_TEST(test_ekf_reference);
+    RUN_TEST(test_ekf_no_allocation);
+    RUN_TEST(test_ud_filter_reference);
+    RUN_TEST(test_ud_filter_float);
+    RUN_TEST(test_ukf_linear);
+    RUN_TEST(test_ukf_square);
+    RUN_TEST(test_particle_resampling);
+    RUN_TEST(test_particle_filter);
+    RUN_TEST(test_rls);
+    RUN_TEST(test_rls_block);
+    RUN_TEST(test_innovation_gate);
+    UNITY_END();
+}
+
+void loop() {
+    // Vide car Unity fonctionne avec setup() pour exécuter tous les tests une fois.
+}
+
+#ifdef NATIVE
+int main(int argc, char **argv) {
+    setup();
+    return UNITY_END();
+}
+#endif
\ No newline at end of file